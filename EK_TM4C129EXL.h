@@ -169,6 +169,14 @@ typedef enum EK_TM4C129EXL_WiFiName {
     EK_TM4C129EXL_WIFICOUNT
 } EK_TM4C129EXL_WiFiName;
 
+/*!
+ *  @brief  Initialize the uDMA controller
+ *
+ *  This function enables the uDMA peripheral, installs the shared channel
+ *  control table and the uDMA error Hwi. It is safe to call it more than once.
+ */
+extern void EK_TM4C129EXL_initDMA(void);
+
 /*!
  *  @brief  Initialize the general board specific settings
  *
@@ -0,0 +1,147 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    AdcAlarmTest.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to measure the time from a
+    threshold crossing of the die temperature to the alarm of the ADC0.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The firmware runs in alarm mode over the model of the ADC0. The die
+    crosses the over and under thresholds and the comparators must set
+    adc_Alarm within one TIMER4 period plus one conversion of the
+    sequencer, then release it only past the hysteresis. From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostSim.h"
+#include "Libraries/Adc/Adc.h"
+
+#define TEST_NORMAL_CENTI      2500
+// Four steps of ADC_OVERSAMPLE_FACTOR conversions at the 2 Msps of the model
+#define TEST_CONVERSION_CYCLES (ADC_SEQUENCER_STEPS * ADC_OVERSAMPLE_FACTOR * 60)
+// hostRunUntil() reads the condition every 10 us
+#define TEST_POLL_CYCLES       (10 * HOST_CYCLES_PER_US)
+#define TEST_TIMEOUT_MS        20
+
+static AdcAlarm test_Expected;
+
+static bool testAlarmIs(void)
+{
+    return adc_Alarm == test_Expected;
+}
+
+// Cycles from the crossing of the die to the alarm, 0 when it never came
+static uint64_t testCross(int32_t centi, AdcAlarm expected)
+{
+    uint64_t start = host_Cycles;
+
+    test_Expected = expected;
+    hostAdcSetDieTemperature(centi);
+    if(!hostRunUntil(testAlarmIs, TEST_TIMEOUT_MS)) { return 0; }
+    return host_Cycles - start;
+}
+
+static void testThreshold(const char* name, int32_t threshold, int32_t inside, AdcAlarm alarm)
+{
+    uint64_t bound = SYSCLOCK_SPEED / adc_Sample_Rate + TEST_CONVERSION_CYCLES + TEST_POLL_CYCLES;
+    uint32_t count = adc_Alarm_Count;
+    uint64_t cycles;
+
+    // The die can cross just after a trigger and wait for the whole period
+    cycles = testCross(threshold + (threshold - inside), alarm);
+    HOST_CHECK(cycles != 0, "%s: no alarm at %d", name, threshold);
+    HOST_CHECK(cycles <= bound, "%s: alarm after %llu cycles, bound %llu", name,
+               (unsigned long long)cycles, (unsigned long long)bound);
+    HOST_CHECK(adc_Alarm_Latency >= TEST_CONVERSION_CYCLES && adc_Alarm_Latency <= TEST_CONVERSION_CYCLES + TEST_POLL_CYCLES,
+               "%s: %u cycles from the trigger", name, adc_Alarm_Latency);
+    HOST_CHECK(adc_Alarm_Count == count + 1, "%s: %u alarms", name, adc_Alarm_Count - count);
+
+    // Staying past the threshold does not interrupt again
+    hostRunCycles((uint64_t)TEST_TIMEOUT_MS * HOST_CYCLES_PER_MS);
+    HOST_CHECK(adc_Alarm_Count == count + 1, "%s: %u alarms while it stays", name, adc_Alarm_Count - count);
+
+    // Back inside the threshold but not past the hysteresis
+    test_Expected = adc_Alarm_None;
+    hostAdcSetDieTemperature((3 * threshold + inside) / 4);
+    HOST_CHECK(!hostRunUntil(testAlarmIs, TEST_TIMEOUT_MS), "%s: released inside the hysteresis", name);
+
+    cycles = testCross(inside, adc_Alarm_None);
+    HOST_CHECK(cycles != 0 && cycles <= bound, "%s: released after %llu cycles", name, (unsigned long long)cycles);
+    HOST_CHECK(adc_Alarm_Count == count + 1, "%s: %u alarms at the release", name, adc_Alarm_Count - count);
+}
+
+static void testRate(uint32_t rate)
+{
+    char name[32];
+
+    adcSetSampleRate(rate);
+    hostAdcSetDieTemperature(TEST_NORMAL_CENTI);
+    hostRunCycles((uint64_t)TEST_TIMEOUT_MS * HOST_CYCLES_PER_MS);
+    HOST_CHECK(adc_Alarm == adc_Alarm_None, "%u Hz: alarm %d at %d", rate, adc_Alarm, TEST_NORMAL_CENTI);
+
+    snprintf(name, sizeof(name), "over at %u Hz", rate);
+    testThreshold(name, adc_Alarm_Over_Centi, adc_Alarm_Over_Centi - 2 * ADC_ALARM_HYSTERESIS_CENTI, adc_Alarm_Over);
+    snprintf(name, sizeof(name), "under at %u Hz", rate);
+    testThreshold(name, adc_Alarm_Under_Centi, adc_Alarm_Under_Centi + 2 * ADC_ALARM_HYSTERESIS_CENTI, adc_Alarm_Under);
+}
+
+int main(void)
+{
+    hostAdcSetDieTemperature(TEST_NORMAL_CENTI);
+    firmwareMain();
+    adcSetAlarmMode(true);
+
+    testRate(ADC_SAMPLE_RATE_HZ);
+    testRate(ADC_SAMPLE_RATE_MAX_HZ);
+
+    // The stream takes the sequencer back and forgets the alarm
+    hostAdcSetDieTemperature(adc_Alarm_Over_Centi + ADC_ALARM_HYSTERESIS_CENTI);
+    hostRunCycles((uint64_t)TEST_TIMEOUT_MS * HOST_CYCLES_PER_MS);
+    adcSetAlarmMode(false);
+    HOST_CHECK(adc_Alarm == adc_Alarm_None, "alarm %d in stream mode", adc_Alarm);
+
+    return hostCheckResult("AdcAlarmTest");
+}
+
+// End of file
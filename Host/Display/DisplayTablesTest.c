@@ -0,0 +1,252 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    DisplayTablesTest.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to compare the frames of the
+    display tables with the runtime conversion they replaced.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    displayTempValue() and displayTime() of the V3 driver divided every
+    value digit by digit and sent it with SpiSend(). They are kept here
+    writing to the digits of one MAX7219, and every temperature, minute
+    and hour, PM and blank ones included, must give the same 8 digits in
+    the framebuffer of displayPanelTempValue() and displayPanelTime().
+    From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "HostSim.h"
+#include "Libraries/Display/Display.h"
+#include "Libraries/Display/DisplayTables.h"
+
+// Beyond the table the driver divides at runtime again
+#define TEST_TEMP_LIMIT_TENTHS 1200
+
+static uint8_t      test_Digits[DISPLAY_MAX_LENGTH];
+static DisplayPanel test_Panel;
+
+/* *****************************************************************
+ *                 Runtime conversion of the V3 driver
+ * *****************************************************************
+ */
+
+static void oldSpiSend(uint8_t registerAddress, uint8_t registerValue)
+{
+    if(registerAddress >= OP_DIGIT0 && registerAddress <= OP_DIGIT7) { test_Digits[registerAddress - OP_DIGIT0] = registerValue; }
+}
+
+static void oldCleanDisplay(void)
+{
+    memset(test_Digits, 0, sizeof(test_Digits));
+}
+
+static void oldDisplayTempValue(const float tempValue)
+{
+    float floatValue = tempValue*10;
+    int  indexCounter = 0, auxValue = abs((int)floatValue), digitValue = 0 ;
+
+    oldCleanDisplay();
+    oldSpiSend(OP_DIGIT0, SEVEN_DIGIT_DISPLAY_C_LETTER_CL);
+    oldSpiSend(OP_DIGIT1, SEVEN_DIGIT_DISPLAY_DEGREE);
+    if(auxValue >= 1000000)
+    {
+        auxValue = 99999;
+    }
+    indexCounter = OP_DIGIT2;
+    do
+    {
+        digitValue = auxValue % 10 ;
+        auxValue = (auxValue - digitValue)/10;
+        if(indexCounter == OP_DIGIT3)
+        {
+            oldSpiSend(indexCounter, sevenDigitDisplayMatrix[digitValue] | 0x80);
+        }
+        else
+        {
+            oldSpiSend(indexCounter, sevenDigitDisplayMatrix[digitValue]);
+        }
+        indexCounter++;
+    }while((auxValue > 0 && indexCounter < DISPLAY_MAX_LENGTH) || indexCounter < OP_DIGIT4);
+    if(tempValue < 0)
+    {
+        oldSpiSend(indexCounter, SEVEN_DIGIT_DISPLAY_MINUS);
+    }
+}
+
+static void oldDisplayTime(const uint8_t hours, const uint8_t minutes)
+{
+    int  indexCounter = 0, auxHours = hours, auxMinutes = minutes, digitValue = 0, displayCounter = 0;
+    static bool ampmFlag = false;
+
+    oldCleanDisplay();
+    if(auxHours < HOUR_FORMAT_12)
+    {
+        ampmFlag = false;
+    }
+    else if(auxHours != BLANK_VALUE_DISPLAY)
+    {
+        auxHours = auxHours - 12;
+        ampmFlag = true;
+    }
+    if(auxMinutes != BLANK_VALUE_DISPLAY)
+    {
+        indexCounter = OP_DIGIT3;
+        for( displayCounter = 0; displayCounter < 2; displayCounter++)
+        {
+            digitValue = auxMinutes % 10;
+            auxMinutes = (auxMinutes - digitValue)/10;
+            oldSpiSend(indexCounter, sevenDigitDisplayMatrix[digitValue]);
+            indexCounter++;
+        }
+    }
+    if(auxHours != BLANK_VALUE_DISPLAY)
+    {
+        indexCounter = OP_DIGIT5;
+        digitValue = auxHours % 10;
+        auxHours   = (auxHours - digitValue)/10;
+        oldSpiSend(indexCounter, sevenDigitDisplayMatrix[digitValue] | 0x80);
+        indexCounter++;
+        if(auxHours > 0 )
+        {
+            digitValue = auxHours % 10;
+            oldSpiSend(indexCounter, sevenDigitDisplayMatrix[digitValue]);
+        }
+    }
+    oldSpiSend(OP_DIGIT0, SEVEN_DIGIT_DISPLAY_H_LETTER_LC);
+    if(ampmFlag)
+    {
+        oldSpiSend(OP_DIGIT1, SEVEN_DIGIT_DISPLAY_DEGREE);
+    }
+}
+
+/* *****************************************************************
+ *                             Tests
+ * *****************************************************************
+ */
+
+static bool testSameFrame(void)
+{
+    return memcmp(test_Panel.frameBuffer, test_Digits, DISPLAY_MAX_LENGTH) == 0;
+}
+
+static void testSegments(void)
+{
+    uint8_t digit;
+
+    for(digit = 0; digit < 10; digit++)
+    {
+        HOST_CHECK(SEVEN_DIGIT_SEGMENTS(digit) == sevenDigitDisplayMatrix[digit], "segments of %u", digit);
+    }
+}
+
+static void testTemperatures(void)
+{
+    uint32_t failures = 0;
+    int32_t  tenths;
+    int32_t  first = 0;
+
+    for(tenths = -TEST_TEMP_LIMIT_TENTHS; tenths <= TEST_TEMP_LIMIT_TENTHS; tenths++)
+    {
+        oldDisplayTempValue((float)tenths / 10.0f);
+        displayPanelTempValue(&test_Panel, tenths);
+        if(!testSameFrame())
+        {
+            if(failures == 0) { first = tenths; }
+            failures++;
+        }
+    }
+    HOST_CHECK(failures == 0, "%u temperatures differ, the first is %d tenths", failures, first);
+
+    // The table rows themselves, the digits 2, 3 & 4 of the old frame
+    failures = 0;
+    for(tenths = 0; tenths < DISPLAY_TEMP_TABLE_SIZE; tenths++)
+    {
+        oldDisplayTempValue((float)tenths / 10.0f);
+        if(memcmp(displayTempTable[tenths], &test_Digits[OP_DIGIT2 - OP_DIGIT0], DISPLAY_TEMP_TABLE_DIGITS) != 0) { failures++; }
+    }
+    HOST_CHECK(failures == 0, "%u rows of displayTempTable differ", failures);
+}
+
+static uint32_t testTime(uint8_t hours, uint8_t minutes)
+{
+    oldDisplayTime(hours, minutes);
+    displayPanelTime(&test_Panel, hours, minutes);
+    if(testSameFrame()) { return 0; }
+    printf("%02u:%02u differs\n", hours, minutes);
+    return 1;
+}
+
+static void testTimes(void)
+{
+    uint32_t failures = 0;
+    uint8_t  hours, minutes;
+
+    for(hours = 0; hours < DISPLAY_HOURS_TABLE_SIZE; hours++)
+    {
+        for(minutes = 0; minutes < DISPLAY_MINUTES_TABLE_SIZE; minutes++) { failures += testTime(hours, minutes); }
+    }
+    HOST_CHECK(failures == 0, "%u times differ", failures);
+
+    // Hours that blink keep the PM symbol of the last one shown
+    failures  = testTime(15, 30);
+    failures += testTime(BLANK_VALUE_DISPLAY, 30);
+    failures += testTime(9, 30);
+    failures += testTime(BLANK_VALUE_DISPLAY, 30);
+    failures += testTime(21, BLANK_VALUE_DISPLAY);
+    failures += testTime(BLANK_VALUE_DISPLAY, BLANK_VALUE_DISPLAY);
+    HOST_CHECK(failures == 0, "%u blinking times differ", failures);
+}
+
+int main(void)
+{
+    testSegments();
+    testTemperatures();
+    testTimes();
+
+    return hostCheckResult("DisplayTablesTest");
+}
+
+// End of file
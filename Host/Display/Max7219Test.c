@@ -0,0 +1,191 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Max7219Test.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to check the frames of the
+    display driver in the registers of the MAX7219 chain.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Host/Makefile builds it for a single MAX7219 on the SSI2 uDMA, for a
+    chain of 3 on the SSI2 and for a chain of 3 on the bit-banged pins.
+    Every panel shows its own digits, a flush only writes the rows that
+    changed with a NOOP for the panels that did not, and every row is one
+    LOAD of the whole chain. From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <string.h>
+#include "HostSim.h"
+#include "Libraries/Display/Display.h"
+
+#define TEST_FRAME_MS          10
+#define TEST_INTENSITY         (uint8_t)0x05
+
+#if DISPLAY_TRANSPORT == DISPLAY_TRANSPORT_BITBANG
+#define TEST_NAME              "Max7219BitBangTest"
+#elif DISPLAY_CHAIN_LENGTH > 1
+#define TEST_NAME              "Max7219ChainTest"
+#else
+#define TEST_NAME              "Max7219Test"
+#endif
+
+// Single writes leave the words in the FIFO of the SSI, the time lets them go out
+static void testFlush(const char* name)
+{
+    displayFlush();
+    hostRunCycles((uint64_t)TEST_FRAME_MS * HOST_CYCLES_PER_MS);
+    HOST_CHECK(!displayFrameBusy(), "%s: frame still on the wire", name);
+}
+
+// Rows with a digit different from the MAX7219, a flush sends one LOAD for every one
+static uint32_t testChangedRows(void)
+{
+    DisplayHandle panel;
+    uint32_t      rows = 0;
+    uint8_t       digit, position;
+
+    for(digit = 0; digit < DISPLAY_MAX_LENGTH; digit++)
+    {
+        for(position = 0; position < DISPLAY_CHAIN_LENGTH; position++)
+        {
+            panel = displayGetPanel(position);
+            if(panel->frameBuffer[digit] != host_Max7219[position].digits[digit]) { rows++; break; }
+        }
+    }
+    return rows;
+}
+
+static void testPanelsShown(const char* name)
+{
+    uint8_t position;
+
+    for(position = 0; position < DISPLAY_CHAIN_LENGTH; position++)
+    {
+        HOST_CHECK(memcmp(host_Max7219[position].digits, displayGetPanel(position)->frameBuffer, DISPLAY_MAX_LENGTH) == 0,
+                   "%s: MAX7219 %u does not show its panel", name, position);
+    }
+}
+
+static void testInit(void)
+{
+    uint8_t position;
+
+    for(position = 0; position < DISPLAY_CHAIN_LENGTH; position++)
+    {
+        HOST_CHECK(host_Max7219[position].shutdown == SHUTDOWN_NO && host_Max7219[position].scanLimit == 0x07 &&
+                   host_Max7219[position].decodeMode == DECOMODE_NODECODE && host_Max7219[position].displayTest == DISPLAY_TEST_NORMAL_OPERATION,
+                   "init: MAX7219 %u not configured", position);
+    }
+
+    // A single write reaches every MAX7219 with one LOAD
+    for(position = 0; position < DISPLAY_CHAIN_LENGTH; position++) { host_Max7219[position].writes = 0; }
+    host_Max7219_Loads = 0;
+    SpiSend(OP_INTENSITY, TEST_INTENSITY);
+    hostRunCycles((uint64_t)TEST_FRAME_MS * HOST_CYCLES_PER_MS);
+    HOST_CHECK(host_Max7219_Loads == 1, "init: %u loads for one register", host_Max7219_Loads);
+    for(position = 0; position < DISPLAY_CHAIN_LENGTH; position++)
+    {
+        HOST_CHECK(host_Max7219[position].intensity == TEST_INTENSITY && host_Max7219[position].writes == 1,
+                   "init: MAX7219 %u intensity 0x%02x after %u writes", position, host_Max7219[position].intensity,
+                   host_Max7219[position].writes);
+    }
+}
+
+static void testFullFrame(void)
+{
+    uint32_t rows;
+    uint8_t  position;
+
+    // Different digits in every panel, a panel in the wrong position shows
+    for(position = 0; position < DISPLAY_CHAIN_LENGTH; position++)
+    {
+        displayPanelTempValue(displayGetPanel(position), -(int32_t)(111 * position + 234));
+    }
+    rows               = testChangedRows();
+    host_Max7219_Loads = 0;
+    testFlush("full frame");
+    testPanelsShown("full frame");
+    // C, degree, three digits and the minus over a clear display
+    HOST_CHECK(rows == 6 && host_Max7219_Loads == rows, "full frame: %u loads for %u rows", host_Max7219_Loads, rows);
+}
+
+static void testOnePanel(void)
+{
+    DisplayHandle panel = displayGetPanel(DISPLAY_CHAIN_LENGTH - 1);
+    uint32_t      writes[DISPLAY_CHAIN_LENGTH];
+    uint8_t       position;
+
+    for(position = 0; position < DISPLAY_CHAIN_LENGTH; position++) { writes[position] = host_Max7219[position].writes; }
+    host_Max7219_Loads = 0;
+
+    // One digit of the last panel, the others get a NOOP in the same row
+    displayPanelDigit(panel, OP_DIGIT7, SEVEN_DIGIT_DISPLAY_H_LETTER_LC);
+    testFlush("one digit");
+    testPanelsShown("one digit");
+    HOST_CHECK(host_Max7219_Loads == 1, "one digit: %u loads", host_Max7219_Loads);
+    for(position = 0; position < DISPLAY_CHAIN_LENGTH; position++)
+    {
+        HOST_CHECK(host_Max7219[position].writes - writes[position] == (position == DISPLAY_CHAIN_LENGTH - 1 ? 1u : 0u),
+                   "one digit: MAX7219 %u written %u times", position, host_Max7219[position].writes - writes[position]);
+    }
+
+    // Nothing changed, nothing goes to the wire
+    testFlush("same frame");
+    HOST_CHECK(host_Max7219_Loads == 1, "same frame: %u loads", host_Max7219_Loads);
+}
+
+int main(void)
+{
+    hostMax7219Init(DISPLAY_CHAIN_LENGTH);
+    firmwareMain();
+    hostRunCycles((uint64_t)TEST_FRAME_MS * HOST_CYCLES_PER_MS);
+
+    testInit();
+    testFullFrame();
+    testOnePanel();
+
+    return hostCheckResult(TEST_NAME);
+}
+
+// End of file
@@ -0,0 +1,185 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    FilterTest.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to check the EMA and CIC
+    stages of the filter chain against their formulas.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The EMA must follow the exponential of a step and settle on it. The
+    CIC of decimation 4 must keep the DC level for every order, and the
+    one of decimation 16 and order 3 must give the same outputs as three
+    moving sums in 64 bits while its integrators wrap. From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HostSim.h"
+#include "Libraries/Filter/Filter.h"
+
+#define TEST_STEP_LEVEL        2500
+// The integer EMA rounds the output and truncates the update of its state
+#define TEST_EMA_TOLERANCE     2
+// Samples of 14 bits, the limit of FILTER_CIC_MAX_DECIMATION
+#define TEST_CIC_SAMPLE_MAX    8191
+#define TEST_CIC_SAMPLES       200000
+
+static FilterStage test_Stage;
+
+static void testStage(FilterType type, uint8_t parameter, uint8_t order)
+{
+    memset(&test_Stage, 0, sizeof(test_Stage));
+    test_Stage.type      = type;
+    test_Stage.parameter = parameter;
+    test_Stage.order     = order;
+}
+
+static void testEmaStep(uint8_t shift, int32_t from, int32_t to)
+{
+    double   alpha  = 1.0 / (double)(1 << shift);
+    uint32_t errors = 0;
+    uint32_t index;
+    int32_t  sample;
+    double   expected;
+
+    testStage(filter_Ema, shift, 0);
+    sample = from;
+    filterProcess(&test_Stage, 1, &sample);
+    HOST_CHECK(sample == from, "EMA 1/%u: first output %d for %d", 1u << shift, sample, from);
+
+    // y[n] = to + (from - to) * (1 - alpha)^n after the step
+    for(index = 1; index <= 64u << shift; index++)
+    {
+        sample = to;
+        filterProcess(&test_Stage, 1, &sample);
+        expected = to + (from - to) * pow(1.0 - alpha, (double)index);
+        if(fabs(sample - expected) > TEST_EMA_TOLERANCE) { errors++; }
+    }
+    HOST_CHECK(errors == 0, "EMA 1/%u: %u outputs away from the step response", 1u << shift, errors);
+    HOST_CHECK(sample == to, "EMA 1/%u: settled at %d for %d", 1u << shift, sample, to);
+}
+
+static void testCicDcGain(uint8_t order, int32_t level)
+{
+    uint32_t outputs = 0;
+    uint32_t errors  = 0;
+    uint32_t index;
+    int32_t  sample;
+
+    testStage(filter_Cic, 4, order);
+    for(index = 0; index < 4 * 64; index++)
+    {
+        sample = level;
+        if(!filterProcess(&test_Stage, 1, &sample)) { continue; }
+        outputs++;
+        // The first outputs still hold the zeros of the reset
+        if(outputs > order && sample != level) { errors++; }
+    }
+    HOST_CHECK(outputs == 64, "CIC R=4 N=%u: %u outputs for 256 samples", order, outputs);
+    HOST_CHECK(errors == 0, "CIC R=4 N=%u: %u outputs differ from %d", order, errors, level);
+}
+
+// Three moving sums of 16 samples without wrap, the transfer function of the CIC
+static void testCicWrap(int32_t offset, int32_t amplitude)
+{
+    int64_t  history[FILTER_CIC_MAX_ORDER + 1][FILTER_CIC_MAX_DECIMATION] = { { 0 } };
+    int64_t  sums[FILTER_CIC_MAX_ORDER + 1] = { 0 };
+    int64_t  gain = FILTER_CIC_MAX_DECIMATION * FILTER_CIC_MAX_DECIMATION * FILTER_CIC_MAX_DECIMATION;
+    uint32_t errors = 0;
+    uint32_t outputs = 0;
+    uint32_t index;
+    uint32_t last = 0;
+    bool     wrapped = false;
+    uint8_t  level;
+    int64_t  input;
+    int32_t  sample;
+
+    testStage(filter_Cic, FILTER_CIC_MAX_DECIMATION, FILTER_CIC_MAX_ORDER);
+    srand(3);
+    for(index = 0; index < TEST_CIC_SAMPLES; index++)
+    {
+        sample = offset + (amplitude != 0 ? rand() % (2 * amplitude + 1) - amplitude : 0);
+        input  = sample;
+        for(level = 1; level <= FILTER_CIC_MAX_ORDER; level++)
+        {
+            sums[level] += input - history[level][index % FILTER_CIC_MAX_DECIMATION];
+            history[level][index % FILTER_CIC_MAX_DECIMATION] = input;
+            input = sums[level];
+        }
+        if(!filterProcess(&test_Stage, 1, &sample)) { continue; }
+        outputs++;
+        if(sample != (int32_t)(input / gain)) { errors++; }
+        // With a positive input the last integrator only goes back when it wraps
+        if((uint32_t)test_Stage.state[FILTER_CIC_MAX_ORDER - 1] < last) { wrapped = true; }
+        last = (uint32_t)test_Stage.state[FILTER_CIC_MAX_ORDER - 1];
+    }
+    HOST_CHECK(outputs == TEST_CIC_SAMPLES / FILTER_CIC_MAX_DECIMATION, "CIC R=16 N=3: %u outputs", outputs);
+    HOST_CHECK(errors == 0, "CIC R=16 N=3 at %d +- %d: %u outputs differ from the moving sums", offset, amplitude, errors);
+    HOST_CHECK(offset <= 0 || wrapped, "CIC R=16 N=3 at %d: the integrators never wrapped", offset);
+}
+
+int main(void)
+{
+    uint8_t order;
+
+    testEmaStep(1, 0, TEST_STEP_LEVEL);
+    testEmaStep(4, 0, TEST_STEP_LEVEL);
+    testEmaStep(FILTER_EMA_MAX_SHIFT, TEST_STEP_LEVEL, -TEST_STEP_LEVEL);
+
+    for(order = 1; order <= FILTER_CIC_MAX_ORDER; order++)
+    {
+        testCicDcGain(order, TEST_STEP_LEVEL);
+        testCicDcGain(order, -TEST_CIC_SAMPLE_MAX);
+    }
+
+    testCicWrap(TEST_CIC_SAMPLE_MAX, 0);
+    testCicWrap(-TEST_CIC_SAMPLE_MAX, 0);
+    testCicWrap(0, TEST_CIC_SAMPLE_MAX);
+
+    return hostCheckResult("FilterTest");
+}
+
+// End of file
@@ -0,0 +1,218 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    FormatBench.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to compare the Format library
+    with the displayIntValue() it replaced in a Linux host.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    displayIntValue() of the V3 driver is kept here writing to a buffer
+    instead of UARTCharPut(). Every integer and tenths value of the sweep
+    must give the same text with formatInteger() and formatFixed(), then
+    both are timed over the same values. From Host:
+        make bench
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../../Libraries/Format/Format.h"
+
+// Macros of the V3 Rs232.h
+#define ZERO_CHAR_VALUE               (uint8_t)48
+#define SINGLE_POINT_CHAR             '.'
+#define MINUS_CHAR                    '-'
+#define NUMBER_MAX_STRING_LENGTH      (uint8_t)10
+#define DECIMAL_POINT_POSITION        1
+#define MINIMUM_LENGTH_POSITION       1
+#define INT_STATE                     0
+#define FLOAT_STATE                   1
+#define FLOATING_POINT_MINIMUM_LENGTH 3
+
+// Every value of the sweep, then the edges of the text of displayIntValue()
+#define BENCH_SWEEP_LIMIT             1000000
+#define BENCH_RANDOM_VALUES           1000000
+// displayIntValue() has room for 10 characters, the point takes one of them
+#define BENCH_INT_LIMIT               2147483647
+#define BENCH_FIXED_LIMIT             999999999
+#define BENCH_TEXT_LENGTH             16
+#define BENCH_ROUNDS                  8
+
+static char   bench_Text[BENCH_TEXT_LENGTH];
+static size_t bench_Length;
+
+static double benchSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+static void UARTCharPut(char character)
+{
+    bench_Text[bench_Length++] = character;
+}
+
+static void displayIntValue(const int tempValue, const int state)
+{
+    int  indexCounter = 0, auxValue = abs(tempValue), digitValue = 0, stringLength = MINIMUM_LENGTH_POSITION;
+    char intValueString[NUMBER_MAX_STRING_LENGTH] = {0};
+    if(tempValue < 0)
+    {
+        UARTCharPut(MINUS_CHAR);
+    }
+    //Changes the minimum lenth of the string
+    if(state)
+    {
+        stringLength = FLOATING_POINT_MINIMUM_LENGTH;
+    }
+    // Fills the string and then it displays the values in order
+    do
+    {
+        digitValue = auxValue % 10 ;
+        auxValue = (auxValue - digitValue)/10;
+        // Checks if the number is integer or float
+        if(indexCounter == DECIMAL_POINT_POSITION && state)
+        {
+            // Adds the decimal point to the value
+            intValueString[NUMBER_MAX_STRING_LENGTH-1-indexCounter] = SINGLE_POINT_CHAR;
+            indexCounter++;
+        }
+        intValueString[NUMBER_MAX_STRING_LENGTH-1-indexCounter] = digitValue + ZERO_CHAR_VALUE;
+        indexCounter++;
+    }while((auxValue > 0 && indexCounter < NUMBER_MAX_STRING_LENGTH) || indexCounter < stringLength);
+    // Displays all values different from NULL
+    for(indexCounter = 0; indexCounter < NUMBER_MAX_STRING_LENGTH; indexCounter++)
+    {
+        if( intValueString[indexCounter] != 0)
+        {
+            UARTCharPut(intValueString[indexCounter]);
+        }
+    }
+}
+
+// 0 when both give the same text
+static int benchCompare(int32_t value, int state)
+{
+    char    text[FORMAT_FIXED_MAX_LENGTH];
+    uint8_t length;
+
+    bench_Length = 0;
+    displayIntValue(value, state);
+    length = (state == FLOAT_STATE) ? formatFixed(text, value, FORMAT_TENTHS) : formatInteger(text, value);
+    if(length == bench_Length && memcmp(text, bench_Text, length) == 0) { return 0; }
+
+    printf("%d %s: \"%.*s\" and \"%.*s\"\n", value, state == FLOAT_STATE ? "tenths" : "integer",
+           (int)bench_Length, bench_Text, (int)length, text);
+    return 1;
+}
+
+static int32_t benchRandom(int32_t limit)
+{
+    int64_t value = ((int64_t)rand() << 16) ^ rand();
+
+    return (int32_t)(value % ((int64_t)limit * 2 + 1) - limit);
+}
+
+int main(void)
+{
+    static const int32_t edges[] = { 0, 9, 10, 99, 100, 999, 1000, 99999, 100000, 999999999, 1000000000, BENCH_INT_LIMIT };
+    int32_t* values = malloc(BENCH_RANDOM_VALUES * sizeof(int32_t));
+    char     text[FORMAT_FIXED_MAX_LENGTH];
+    uint32_t differences = 0, index, round;
+    int32_t  value;
+    size_t   checksum = 0;
+    double   start, oldSeconds, newSeconds;
+
+    if(values == NULL) { return 1; }
+
+    for(value = -BENCH_SWEEP_LIMIT; value <= BENCH_SWEEP_LIMIT; value++)
+    {
+        differences += benchCompare(value, INT_STATE);
+        differences += benchCompare(value, FLOAT_STATE);
+    }
+    for(index = 0; index < sizeof(edges) / sizeof(edges[0]); index++)
+    {
+        differences += benchCompare(edges[index], INT_STATE);
+        differences += benchCompare(-edges[index], INT_STATE);
+        if(edges[index] <= BENCH_FIXED_LIMIT)
+        {
+            differences += benchCompare(edges[index], FLOAT_STATE);
+            differences += benchCompare(-edges[index], FLOAT_STATE);
+        }
+    }
+
+    // Temperatures in tenths of the whole range of the sensor, the values of the UART
+    srand(1);
+    for(index = 0; index < BENCH_RANDOM_VALUES; index++)
+    {
+        values[index] = benchRandom((index & 1) ? BENCH_FIXED_LIMIT : 1000);
+        differences  += benchCompare(values[index], FLOAT_STATE);
+    }
+
+    start = benchSeconds();
+    for(round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for(index = 0; index < BENCH_RANDOM_VALUES; index++)
+        {
+            bench_Length = 0;
+            displayIntValue(values[index], FLOAT_STATE);
+            checksum += bench_Length + (uint8_t)bench_Text[0];
+        }
+    }
+    oldSeconds = benchSeconds() - start;
+
+    start = benchSeconds();
+    for(round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for(index = 0; index < BENCH_RANDOM_VALUES; index++)
+        {
+            checksum += formatFixed(text, values[index], FORMAT_TENTHS) + (uint8_t)text[0];
+        }
+    }
+    newSeconds = benchSeconds() - start;
+
+    printf("function          ns/value\n");
+    printf("displayIntValue   %8.2f\n", oldSeconds / ((double)BENCH_RANDOM_VALUES * BENCH_ROUNDS) * 1e9);
+    printf("formatFixed       %8.2f\n", newSeconds / ((double)BENCH_RANDOM_VALUES * BENCH_ROUNDS) * 1e9);
+    printf("differences %u, checksum %zu\n", differences, checksum);
+
+    free(values);
+    return differences == 0 ? 0 : 1;
+}
+
+// End of file
@@ -0,0 +1,214 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    ClassifierTest.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to test classifyTemperature()
+    with the spike, step and recovery sequences.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Every sequence starts from a sensor stable at TEST_LEVEL_CENTI. A spike
+    of one sample is abnormal once and leaves the mean where it was, a step
+    to a new level is abnormal once and starts new statistics there, and
+    the samples after a lost connection start them too. From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <string.h>
+#include "HostSim.h"
+#include "Libraries/Sensor/Sensor.h"
+
+#define TEST_LEVEL_CENTI       2500
+// A few hundredths of noise, far below DELTA_TEMPERATURE_LOWER_LIMIT
+#define TEST_NOISE_CENTI       4
+#define TEST_SPIKE_CENTI       ((DELTA_TEMPERATURE_UPPER_LIMIT + 5) * CENTIDEGREES_PER_DEGREE)
+#define TEST_MODERATE_CENTI    ((DELTA_TEMPERATURE_LOWER_LIMIT + 2) * CENTIDEGREES_PER_DEGREE)
+#define TEST_STABLE_SAMPLES    (SENSOR_STATISTICS_WINDOW + MAXIMUM_STABILIZING_SAMPLES)
+
+static SensorStatistics      test_Statistics;
+static DetaTemperatureStatus test_Status;
+static uint32_t              test_Abnormal;
+static uint32_t              test_Sample;
+
+static void testClassify(int32_t temperature)
+{
+    DetaTemperatureStatus status = classifyTemperature(&test_Statistics, test_Status, temperature);
+
+    // Counts the samples that enter the abnormal status, not the ones that stay in it
+    if(status == data_Temp_Abnormal && test_Status != data_Temp_Abnormal) { test_Abnormal++; }
+    test_Status = status;
+    test_Sample++;
+}
+
+// Noise of a real sensor around the level, the same every run
+static int32_t testNoise(void)
+{
+    return (int32_t)((test_Sample * 7) % (2 * TEST_NOISE_CENTI + 1)) - TEST_NOISE_CENTI;
+}
+
+static void testStable(int32_t level, uint32_t samples)
+{
+    uint32_t index;
+
+    for(index = 0; index < samples; index++) { testClassify(level + testNoise()); }
+}
+
+static void testStart(void)
+{
+    memset(&test_Statistics, 0, sizeof(test_Statistics));
+    test_Status   = data_Temp_Stabilizing;
+    test_Abnormal = 0;
+    testStable(TEST_LEVEL_CENTI, TEST_STABLE_SAMPLES);
+    HOST_CHECK(test_Status == data_Temp_Normal, "stable sensor in status %d", test_Status);
+    HOST_CHECK(test_Abnormal == 0, "stable sensor abnormal %u times", test_Abnormal);
+}
+
+static int32_t testMean(void)
+{
+    return test_Statistics.meanQ8 >> SENSOR_MEAN_SHIFT;
+}
+
+static void testSpike(void)
+{
+    int32_t  mean;
+    int32_t  variance;
+
+    testStart();
+    mean     = testMean();
+    variance = test_Statistics.variance;
+
+    testClassify(TEST_LEVEL_CENTI + TEST_SPIKE_CENTI);
+    HOST_CHECK(test_Status == data_Temp_Abnormal, "spike: status %d", test_Status);
+
+    // The sample after the spike is compared with the last good one, not with the spike
+    testClassify(TEST_LEVEL_CENTI);
+    HOST_CHECK(test_Status == data_Temp_Stabilizing, "spike: status %d after it", test_Status);
+    HOST_CHECK(test_Abnormal == 1, "spike: abnormal %u times", test_Abnormal);
+    HOST_CHECK(testMean() >= mean - TEST_NOISE_CENTI && testMean() <= mean + TEST_NOISE_CENTI,
+               "spike: mean %d moved from %d", testMean(), mean);
+    HOST_CHECK(test_Statistics.variance <= variance + TEST_NOISE_CENTI * TEST_NOISE_CENTI,
+               "spike: variance %d grew from %d", test_Statistics.variance, variance);
+
+    testStable(TEST_LEVEL_CENTI, MAXIMUM_STABILIZING_SAMPLES);
+    HOST_CHECK(test_Status == data_Temp_Normal, "spike: status %d after the calm samples", test_Status);
+}
+
+static void testStep(void)
+{
+    int32_t level = TEST_LEVEL_CENTI + TEST_SPIKE_CENTI;
+
+    testStart();
+    testClassify(level);
+    HOST_CHECK(test_Status == data_Temp_Abnormal, "step: status %d", test_Status);
+
+    // The second sample at the new level confirms it, the statistics start again there
+    testClassify(level);
+    HOST_CHECK(test_Status == data_Temp_Stabilizing, "step: status %d at the new level", test_Status);
+    HOST_CHECK(testMean() == level, "step: mean %d for the level %d", testMean(), level);
+    HOST_CHECK(test_Abnormal == 1, "step: abnormal %u times", test_Abnormal);
+
+    testStable(level, MAXIMUM_STABILIZING_SAMPLES);
+    HOST_CHECK(test_Status == data_Temp_Normal, "step: status %d after the calm samples", test_Status);
+    HOST_CHECK(test_Abnormal == 1, "step: abnormal %u times at the end", test_Abnormal);
+}
+
+static void testAbnormalHoldsStatistics(void)
+{
+    SensorStatistics before;
+
+    testStart();
+    testClassify(TEST_LEVEL_CENTI + TEST_SPIKE_CENTI);
+    before = test_Statistics;
+
+    // A moderate step away from both the good level and the spike keeps the status
+    testClassify(TEST_LEVEL_CENTI + TEST_MODERATE_CENTI);
+    HOST_CHECK(test_Status == data_Temp_Abnormal, "abnormal: status %d after a moderate step", test_Status);
+    HOST_CHECK(test_Statistics.meanQ8 == before.meanQ8 && test_Statistics.variance == before.variance &&
+               test_Statistics.count == before.count, "abnormal: statistics updated");
+    HOST_CHECK(test_Statistics.previous == before.previous, "abnormal: reference of the step moved to %d",
+               test_Statistics.previous);
+
+    // Back at the good level
+    testClassify(TEST_LEVEL_CENTI);
+    HOST_CHECK(test_Status == data_Temp_Stabilizing, "abnormal: status %d when back", test_Status);
+    HOST_CHECK(test_Abnormal == 1, "abnormal: abnormal %u times", test_Abnormal);
+}
+
+static void testOutlier(void)
+{
+    testStart();
+    // Under the step limit but far from the mean of a quiet sensor
+    testClassify(TEST_LEVEL_CENTI + TEST_MODERATE_CENTI);
+    HOST_CHECK(test_Status == data_Temp_Abnormal, "outlier: status %d", test_Status);
+    testClassify(TEST_LEVEL_CENTI);
+    HOST_CHECK(test_Status == data_Temp_Stabilizing, "outlier: status %d after it", test_Status);
+    HOST_CHECK(test_Abnormal == 1, "outlier: abnormal %u times", test_Abnormal);
+}
+
+static void testLostConnection(void)
+{
+    int32_t level = TEST_LEVEL_CENTI - TEST_SPIKE_CENTI;
+
+    testStart();
+    // The first sample after the sensor came back starts new statistics, whatever its value
+    test_Status = data_Temp_LostConnection;
+    testClassify(level);
+    HOST_CHECK(test_Status == data_Temp_Stabilizing, "lost connection: status %d", test_Status);
+    HOST_CHECK(testMean() == level, "lost connection: mean %d for %d", testMean(), level);
+    testStable(level, MAXIMUM_STABILIZING_SAMPLES);
+    HOST_CHECK(test_Status == data_Temp_Normal, "lost connection: status %d after the calm samples", test_Status);
+    HOST_CHECK(test_Abnormal == 0, "lost connection: abnormal %u times", test_Abnormal);
+}
+
+int main(void)
+{
+    testSpike();
+    testStep();
+    testAbnormalHoldsStatistics();
+    testOutlier();
+    testLostConnection();
+
+    return hostCheckResult("ClassifierTest");
+}
+
+// End of file
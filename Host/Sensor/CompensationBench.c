@@ -0,0 +1,126 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    CompensationBench.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to time the integer and the
+    double compensation of the BME280 temperature.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Both formulas run over the whole 20 bits range of the ADC. The host
+    has a hardware double unit, so its ratio is the lower bound of the M4F
+    one that calls the software double routines. On the board the cycles
+    of every build come from sensor_Compensation_Cycles. From Host:
+        make bench
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <time.h>
+#include "HostSim.h"
+#include "Libraries/Sensor/Sensor.h"
+
+#define BENCH_DIGIT_T1         27504
+#define BENCH_DIGIT_T2         26435
+#define BENCH_DIGIT_T3         (-1000)
+#define BENCH_ADC_RANGE        (1UL << 20)
+#define BENCH_ROUNDS           16
+
+static double benchSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+// Time stamp counter of the host, 0 where there is none
+static uint64_t benchCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+int main(void)
+{
+    volatile int32_t sink = 0;
+    uint32_t adc;
+    uint32_t round;
+    uint64_t cycles, integerCycles, doubleCycles;
+    double   start, integerSeconds, doubleSeconds;
+    double   calls = (double)BENCH_ADC_RANGE * BENCH_ROUNDS;
+
+    start  = benchSeconds();
+    cycles = benchCycles();
+    for(round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for(adc = 0; adc < BENCH_ADC_RANGE; adc++)
+        {
+            sink = compensateTemperatureInteger(adc, BENCH_DIGIT_T1, BENCH_DIGIT_T2, BENCH_DIGIT_T3);
+        }
+    }
+    integerCycles  = benchCycles() - cycles;
+    integerSeconds = benchSeconds() - start;
+
+    start  = benchSeconds();
+    cycles = benchCycles();
+    for(round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for(adc = 0; adc < BENCH_ADC_RANGE; adc++)
+        {
+            sink = (int32_t)(compensateTemperature(adc, BENCH_DIGIT_T1, BENCH_DIGIT_T2, BENCH_DIGIT_T3) * CENTIDEGREES_PER_DEGREE);
+        }
+    }
+    doubleCycles  = benchCycles() - cycles;
+    doubleSeconds = benchSeconds() - start;
+
+    printf("compensation  ns/sample  tsc/sample\n");
+    printf("integer       %9.2f  %10.2f\n", integerSeconds / calls * 1e9, (double)integerCycles / calls);
+    printf("double        %9.2f  %10.2f\n", doubleSeconds / calls * 1e9, (double)doubleCycles / calls);
+    printf("double / integer %.2f, last %d\n", doubleSeconds / integerSeconds, sink);
+
+    return 0;
+}
+
+// End of file
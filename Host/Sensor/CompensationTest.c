@@ -0,0 +1,136 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    CompensationTest.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to compare the integer and the
+    double compensation of the BME280 temperature.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Every raw temperature of the 20 bits of the ADC goes through
+    compensateTemperatureInteger() and compensateTemperature() with the
+    calibration of the datasheet example. Both must give the same
+    centi-degrees within TEST_TOLERANCE_CENTI, sensor_T_Fine included,
+    and clamp at the same limits. The pressure of the example reading must
+    be the one of the datasheet within TEST_TOLERANCE_PA. From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostSim.h"
+#include "Libraries/Sensor/Sensor.h"
+
+// Calibration of the example of the BME280 datasheet, the one of the model
+#define TEST_DIGIT_T1          27504
+#define TEST_DIGIT_T2          26435
+#define TEST_DIGIT_T3          (-1000)
+#define TEST_ADC_RANGE         (1UL << 20)
+// Every shift of the integer formula drops a fraction of a centi-degree,
+// sensor_T_Fine is in 1/5120 degree so 16 of it are 0.3 centi-degrees
+#define TEST_TOLERANCE_CENTI   1
+#define TEST_TOLERANCE_FINE    16
+// Example reading of the datasheet, 25.08 degrees before the offset of the firmware and
+// 100653 Pa with the double formulas
+#define TEST_EXAMPLE_ADC_T     519888
+#define TEST_EXAMPLE_ADC_P     415148
+#define TEST_EXAMPLE_CENTI     2508
+#define TEST_EXAMPLE_PA        100653
+#define TEST_TOLERANCE_PA      4
+
+static const SensorCalibration test_Calibration =
+{
+    TEST_DIGIT_T1, TEST_DIGIT_T2, TEST_DIGIT_T3,
+    36477, -10685, 3024, 2855, 140, -7, 15500, -14600, 6000,
+};
+
+int main(void)
+{
+    uint32_t adc;
+    uint32_t failures = 0;
+    uint32_t fineFailures = 0;
+    uint32_t clamped  = 0;
+    int32_t  integer, floating, fineInteger, fineFloating, difference;
+    int32_t  worst = 0;
+    uint32_t worstAdc = 0;
+    uint32_t pascals;
+
+    for(adc = 0; adc < TEST_ADC_RANGE; adc++)
+    {
+        integer     = compensateTemperatureInteger(adc, TEST_DIGIT_T1, TEST_DIGIT_T2, TEST_DIGIT_T3);
+        fineInteger = sensor_T_Fine;
+        // Same conversion of processTemperatureSamples() with SENSOR_COMPENSATION_DOUBLE
+        floating     = (int32_t)(compensateTemperature(adc, TEST_DIGIT_T1, TEST_DIGIT_T2, TEST_DIGIT_T3) * CENTIDEGREES_PER_DEGREE);
+        fineFloating = sensor_T_Fine;
+
+        if(integer == TEMPERATURE_MIN_CENTIDEGREES || integer == TEMPERATURE_MAX_CENTIDEGREES) { clamped++; }
+        difference = integer - floating;
+        if(difference < 0) { difference = -difference; }
+        if(difference > worst) { worst = difference; worstAdc = adc; }
+        if(difference > TEST_TOLERANCE_CENTI) { failures++; }
+        // Inside the limits both formulas must also agree on the fine temperature of the pressure and humidity
+        else if(integer > TEMPERATURE_MIN_CENTIDEGREES && integer < TEMPERATURE_MAX_CENTIDEGREES &&
+                (fineInteger - fineFloating > TEST_TOLERANCE_FINE || fineFloating - fineInteger > TEST_TOLERANCE_FINE))
+        {
+            fineFailures++;
+        }
+    }
+
+    HOST_CHECK(failures == 0, "%u raw values differ, worst %d centi-degrees at 0x%05x", failures, worst, worstAdc);
+    HOST_CHECK(fineFailures == 0, "%u raw values differ in sensor_T_Fine", fineFailures);
+    // The range of the ADC goes past both limits of the sensor
+    HOST_CHECK(clamped > 0 && clamped < TEST_ADC_RANGE, "%u raw values clamped", clamped);
+    HOST_CHECK(compensateTemperatureInteger(0, TEST_DIGIT_T1, TEST_DIGIT_T2, TEST_DIGIT_T3) == TEMPERATURE_MIN_CENTIDEGREES,
+               "raw 0 is not the lower limit");
+    HOST_CHECK(compensateTemperatureInteger(TEST_ADC_RANGE - 1, TEST_DIGIT_T1, TEST_DIGIT_T2, TEST_DIGIT_T3) == TEMPERATURE_MAX_CENTIDEGREES,
+               "the last raw value is not the upper limit");
+
+    // The pressure takes sensor_T_Fine from the temperature of the same reading
+    integer = compensateTemperatureInteger(TEST_EXAMPLE_ADC_T, TEST_DIGIT_T1, TEST_DIGIT_T2, TEST_DIGIT_T3);
+    pascals = compensatePressureInteger(TEST_EXAMPLE_ADC_P, &test_Calibration);
+    HOST_CHECK(integer == TEST_EXAMPLE_CENTI + sensor_Temperature_Compensation, "example temperature %d centi-degrees", integer);
+    HOST_CHECK(pascals >= TEST_EXAMPLE_PA - TEST_TOLERANCE_PA && pascals <= TEST_EXAMPLE_PA + TEST_TOLERANCE_PA,
+               "example pressure %u Pa", pascals);
+
+    return hostCheckResult("CompensationTest");
+}
+
+// End of file
@@ -0,0 +1,164 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    RecoveryTest.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to test the recovery of the
+    BME280 after the faults of the I2C bus.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The firmware is built with SENSOR_FAULT_INJECTION. The faults are NACKs
+    of the sensor, NACKs injected by the firmware, a sensor that holds SDA
+    low in the middle of a byte and a sensor that leaves the bus for a
+    while. After every one of them the sensor must be sampled again inside
+    SENSOR_RECOVERY_BOUND_MS, with the error LED off. From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostSim.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "Libraries/Sensor/Sensor.h"
+
+#define TEST_TEMPERATURE_CENTI 2437
+#define TEST_SETTLE_MS         500
+// Samples after the recovery that prove the sensor is back
+#define TEST_SAMPLES_AFTER     10
+// The sensor stays away for more than LOST_CONNECTION_LIMIT attempts
+#define TEST_ABSENT_MS         2500
+
+static HostBme280    test_Sensor;
+static SensorDevice* test_Device = &sensor_Devices[SENSOR_PRIMARY];
+
+// Runs tick by tick until the next transaction of the sensor fails
+static void testFault(const char* fault, uint32_t limitMs)
+{
+    uint32_t elapsed = 0;
+    uint32_t errors  = test_Device->errors;
+
+    while(test_Device->errors == errors && elapsed < limitMs)
+    {
+        hostRunMilliseconds(SENSOR_TICK_MS);
+        elapsed += SENSOR_TICK_MS;
+    }
+    HOST_CHECK(test_Device->errors != errors, "%s: no fault seen", fault);
+    HOST_CHECK(hostGpioOutput(GPIO_PORTN_BASE, GPIO_PIN_1), "%s: error LED off during the fault", fault);
+}
+
+// Runs tick by tick until the sensor gives new samples again, gives the time from the first fault
+static uint32_t testRecover(const char* fault, uint32_t limitMs)
+{
+    uint32_t elapsed = 0;
+    uint32_t samples;
+
+    while(test_Device->recovering && elapsed < limitMs)
+    {
+        hostRunMilliseconds(SENSOR_TICK_MS);
+        elapsed += SENSOR_TICK_MS;
+    }
+    HOST_CHECK(!test_Device->recovering, "%s: not recovered after %u ms", fault, elapsed);
+
+    samples = test_Device->samples;
+    hostRunMilliseconds(TEST_SAMPLES_AFTER * SENSOR_TICK_MS);
+    HOST_CHECK(test_Device->samples - samples >= TEST_SAMPLES_AFTER - 2, "%s: %u samples after the recovery",
+               fault, test_Device->samples - samples);
+    HOST_CHECK(!hostGpioOutput(GPIO_PORTN_BASE, GPIO_PIN_1), "%s: error LED still on", fault);
+    HOST_CHECK(host_I2c_Overlaps == 0, "%s: %u commands to a busy I2C master", fault, host_I2c_Overlaps);
+
+    return test_Device->recoveryMs;
+}
+
+int main(void)
+{
+    uint32_t resets;
+    uint32_t recoveryMs;
+    uint32_t overBound;
+
+    hostBme280Attach(&test_Sensor, I2C2_BASE, SLAVE_ADDRESS_EXT);
+    hostBme280SetTemperature(&test_Sensor, TEST_TEMPERATURE_CENTI);
+    hostMax7219Init(1);
+
+    firmwareMain();
+    hostRunMilliseconds(TEST_SETTLE_MS);
+    HOST_CHECK(test_Device->samples > 0 && !test_Device->recovering, "no sample before the faults");
+
+    // The sensor NACKs its address a few times in a row, the retries meet it again
+    resets            = test_Sensor.resets;
+    test_Sensor.nacks = 3;
+    testFault("sensor NACK", SENSOR_RECOVERY_BOUND_MS);
+    recoveryMs        = testRecover("sensor NACK", SENSOR_RECOVERY_BOUND_MS * 2);
+    HOST_CHECK(recoveryMs <= SENSOR_RECOVERY_BOUND_MS, "sensor NACK: recovered in %u ms", recoveryMs);
+    HOST_CHECK(test_Sensor.resets > resets, "sensor NACK: no soft reset");
+
+    // NACKs of the firmware knob, every recovery attempt fails until they are used
+    sensor_Injected_Faults = 4;
+    testFault("injected NACK", SENSOR_RECOVERY_BOUND_MS);
+    recoveryMs             = testRecover("injected NACK", SENSOR_RECOVERY_BOUND_MS * 2);
+    HOST_CHECK(recoveryMs <= SENSOR_RECOVERY_BOUND_MS, "injected NACK: recovered in %u ms", recoveryMs);
+    HOST_CHECK(sensor_Injected_Faults == 0, "injected NACK: %u faults left", sensor_Injected_Faults);
+
+    // SDA held low in the middle of a byte, only the clock pulses of the bus clear release it
+    test_Sensor.sdaHeld = 5;
+    testFault("stuck SDA", SENSOR_RECOVERY_BOUND_MS);
+    recoveryMs          = testRecover("stuck SDA", SENSOR_RECOVERY_BOUND_MS * 2);
+    HOST_CHECK(recoveryMs <= SENSOR_RECOVERY_BOUND_MS, "stuck SDA: recovered in %u ms", recoveryMs);
+    HOST_CHECK(test_Sensor.sdaHeld == 0, "stuck SDA: still held for %u pulses", test_Sensor.sdaHeld);
+
+    // A sensor away for longer than the bound is counted and shown as lost, it comes back at the longest backoff
+    overBound          = sensor_Recovery_Over_Bound;
+    test_Sensor.absent = true;
+    testFault("absent sensor", SENSOR_RECOVERY_BOUND_MS);
+    hostRunMilliseconds(TEST_ABSENT_MS);
+    HOST_CHECK(sensor_Delta_Temperature == data_Temp_LostConnection, "absent sensor: status %d",
+               sensor_Delta_Temperature);
+    test_Sensor.absent = false;
+    recoveryMs         = testRecover("absent sensor", (1 << SENSOR_RECOVERY_MAX_SHIFT) * SENSOR_TICK_MS * 2);
+    HOST_CHECK(recoveryMs >= TEST_ABSENT_MS, "absent sensor: recovered in %u ms", recoveryMs);
+    HOST_CHECK(sensor_Delta_Temperature != data_Temp_LostConnection, "absent sensor: still lost after the recovery");
+    HOST_CHECK(sensor_Recovery_Over_Bound == overBound + 1, "absent sensor: %u recoveries over the bound",
+               sensor_Recovery_Over_Bound - overBound);
+
+    return hostCheckResult("RecoveryTest");
+}
+
+// End of file
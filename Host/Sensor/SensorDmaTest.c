@@ -0,0 +1,147 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    SensorDmaTest.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to test the reads of the BME280
+    that the uDMA takes from the RX FIFO of the I2C2, and to compare the
+    interrupts per sample with the reads of the interrupt.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    SensorDmaTest builds the firmware with SENSOR_I2C_DMA, SensorNoDmaTest
+    builds it without. Both sample in forced mode and then in normal mode.
+    With the uDMA it first moves the last byte before the master sends the
+    stop, then its latency grows so the stop comes first. In every phase
+    each read must end once, with the right temperature and without a
+    command to a busy master, and sensor_Interrupts_Per_Sample must be the
+    figure of the build. The figures are printed for both builds. From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostSim.h"
+#include "Libraries/Sensor/Sensor.h"
+
+#define TEST_TEMPERATURE_CENTI 2437
+// The raw value of the model is the first one that reaches the temperature
+#define TEST_TOLERANCE_CENTI   2
+// The mode changes with the next sample, the 1 s timer then needs a whole second of it
+#define TEST_SETTLE_MS         2000
+#define TEST_PHASE_MS          1500
+// The uDMA done before the stop, then well after it, a byte takes 9 bits of 300 cycles at 400 kHz
+#define TEST_LATENCY_EARLY     10
+#define TEST_LATENCY_LATE      30000
+
+// The uDMA empties the RX FIFO instead of the CPU, one interrupt less per sample
+#if SENSOR_I2C_DMA
+#define TEST_NAME              "SensorDmaTest"
+#define TEST_FORCED_INTERRUPTS 5
+#define TEST_NORMAL_INTERRUPTS 3
+#else
+#define TEST_NAME              "SensorNoDmaTest"
+#define TEST_FORCED_INTERRUPTS 6
+#define TEST_NORMAL_INTERRUPTS 4
+#endif
+
+static HostBme280 test_Sensor;
+
+static void testPhase(uint8_t mode, const char* name, uint32_t latency, uint32_t expected, int32_t temperature)
+{
+    uint32_t samples;
+    uint32_t interrupts;
+#if SENSOR_I2C_DMA
+    uint32_t items = hostDmaItems(SENSOR_I2C_DMA_CHANNEL);
+#endif
+
+    host_Dma_Latency = latency;
+    configureSensorMode(mode, T_SB_62_5MS, IIR_OFF);
+    hostRunMilliseconds(TEST_SETTLE_MS);
+
+    samples    = sensor_Samples_Total;
+    interrupts = sensor_Interrupt_Count;
+    hostRunMilliseconds(TEST_PHASE_MS);
+    samples    = sensor_Samples_Total - samples;
+    interrupts = sensor_Interrupt_Count - interrupts;
+
+    HOST_CHECK(samples >= TEST_PHASE_MS / SENSOR_TICK_MS - 2, "%s, latency %u: %u samples", name, latency, samples);
+#if SENSOR_I2C_DMA
+    HOST_CHECK(hostDmaItems(SENSOR_I2C_DMA_CHANNEL) > items, "%s, latency %u: the uDMA moved nothing", name, latency);
+#endif
+    HOST_CHECK(sensor_Temperature_Average >= temperature - TEST_TOLERANCE_CENTI &&
+               sensor_Temperature_Average <= temperature + TEST_TOLERANCE_CENTI,
+               "%s, latency %u: average %d for %d", name, latency, sensor_Temperature_Average, temperature);
+    HOST_CHECK(host_I2c_Overlaps == 0, "%s, latency %u: %u commands to a busy I2C master", name, latency, host_I2c_Overlaps);
+    HOST_CHECK(samples != 0 && sensor_Interrupts_Per_Sample == interrupts / samples,
+               "%s, latency %u: %u interrupts per sample, %u in %u samples", name, latency,
+               sensor_Interrupts_Per_Sample, interrupts, samples);
+    HOST_CHECK(sensor_Interrupts_Per_Sample == expected, "%s, latency %u: %u interrupts per sample for %u",
+               name, latency, sensor_Interrupts_Per_Sample, expected);
+
+    printf("%-16s %-8s %8u %18u\n", TEST_NAME, name, latency, sensor_Interrupts_Per_Sample);
+}
+
+int main(void)
+{
+    int32_t temperature;
+
+    hostBme280Attach(&test_Sensor, I2C2_BASE, SLAVE_ADDRESS_EXT);
+    hostBme280SetTemperature(&test_Sensor, TEST_TEMPERATURE_CENTI);
+    hostMax7219Init(1);
+
+    firmwareMain();
+    temperature = TEST_TEMPERATURE_CENTI + sensor_Temperature_Compensation;
+
+    printf("build            mode      latency  interrupts/sample\n");
+#if SENSOR_I2C_DMA
+    testPhase(MODE_FORCED, "forced", TEST_LATENCY_EARLY, TEST_FORCED_INTERRUPTS, temperature);
+    testPhase(MODE_FORCED, "forced", TEST_LATENCY_LATE, TEST_FORCED_INTERRUPTS, temperature);
+    testPhase(MODE_NORMAL, "normal", TEST_LATENCY_EARLY, TEST_NORMAL_INTERRUPTS, temperature);
+    testPhase(MODE_NORMAL, "normal", TEST_LATENCY_LATE, TEST_NORMAL_INTERRUPTS, temperature);
+#else
+    testPhase(MODE_FORCED, "forced", 0, TEST_FORCED_INTERRUPTS, temperature);
+    testPhase(MODE_NORMAL, "normal", 0, TEST_NORMAL_INTERRUPTS, temperature);
+#endif
+
+    return hostCheckResult(TEST_NAME);
+}
+
+// End of file
@@ -0,0 +1,135 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    SensorModeTest.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to compare the forced and the
+    normal mode of the BME280 on the host.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The firmware samples in forced mode and then in normal mode, selected
+    at runtime with configureSensorMode(). Each mode must keep the rate of
+    the tick with the right temperature. The interrupts per sample of
+    sensor_Interrupts_Per_Sample, the bus cycles of sensor_Bus_Cycles and
+    the cycles from the tick to the data of sensor_Sample_Cycles are
+    printed for both, and normal mode must take fewer interrupts. From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostSim.h"
+#include "Libraries/Sensor/Sensor.h"
+
+#define TEST_TEMPERATURE_CENTI 2437
+// The raw value of the model is the first one that reaches the temperature
+#define TEST_TOLERANCE_CENTI   2
+// The mode changes with the next sample, the 1 s timer then needs a whole second of it
+#define TEST_SETTLE_MS         2000
+#define TEST_PHASE_MS          3000
+
+typedef struct
+{
+    uint32_t interruptsPerSample;
+    uint32_t busCycles;
+    uint32_t sampleCycles;
+}TestFigures;
+
+static HostBme280 test_Sensor;
+
+static void testMode(uint8_t mode, const char* name, int32_t expected, TestFigures* figures)
+{
+    uint32_t samples;
+    uint32_t interrupts;
+
+    configureSensorMode(mode, T_SB_62_5MS, IIR_OFF);
+    hostRunMilliseconds(TEST_SETTLE_MS);
+
+    samples    = sensor_Samples_Total;
+    interrupts = sensor_Interrupt_Count;
+    hostRunMilliseconds(TEST_PHASE_MS);
+    samples    = sensor_Samples_Total - samples;
+    interrupts = sensor_Interrupt_Count - interrupts;
+
+    HOST_CHECK((sensor_Ctrl_Meas & MODE_MASK) == mode, "%s: ctrl_meas 0x%02x", name, sensor_Ctrl_Meas);
+    HOST_CHECK(samples >= TEST_PHASE_MS / SENSOR_TICK_MS - 2, "%s: %u samples", name, samples);
+    HOST_CHECK(sensor_Temperature_Average >= expected - TEST_TOLERANCE_CENTI &&
+               sensor_Temperature_Average <= expected + TEST_TOLERANCE_CENTI,
+               "%s: average %d for %d", name, sensor_Temperature_Average, expected);
+    // The figure of the firmware is the one of the last second, the same as the whole phase
+    HOST_CHECK(samples != 0 && sensor_Interrupts_Per_Sample == interrupts / samples,
+               "%s: %u interrupts per sample, %u in %u samples", name, sensor_Interrupts_Per_Sample, interrupts, samples);
+    HOST_CHECK(sensor_Bus_Cycles.lastCycles != 0, "%s: no bus cycles", name);
+    HOST_CHECK(host_I2c_Overlaps == 0, "%s: %u commands to a busy I2C master", name, host_I2c_Overlaps);
+
+    figures->interruptsPerSample = sensor_Interrupts_Per_Sample;
+    figures->busCycles           = sensor_Bus_Cycles.lastCycles;
+    figures->sampleCycles        = sensor_Sample_Cycles.lastCycles;
+    printf("%-8s %17u %18u %21u\n", name, figures->interruptsPerSample, figures->busCycles, figures->sampleCycles);
+}
+
+int main(void)
+{
+    TestFigures forced;
+    TestFigures normal;
+    int32_t     expected;
+
+    hostBme280Attach(&test_Sensor, I2C2_BASE, SLAVE_ADDRESS_EXT);
+    hostBme280SetTemperature(&test_Sensor, TEST_TEMPERATURE_CENTI);
+    hostMax7219Init(1);
+
+    firmwareMain();
+    expected = TEST_TEMPERATURE_CENTI + sensor_Temperature_Compensation;
+
+    printf("mode     interrupts/sample  bus cycles/sample  tick to data cycles\n");
+    testMode(MODE_FORCED, "forced", expected, &forced);
+    testMode(MODE_NORMAL, "normal", expected, &normal);
+
+    // Normal mode leaves out the ctrl_meas write of every sample
+    HOST_CHECK(normal.interruptsPerSample < forced.interruptsPerSample,
+               "normal %u and forced %u interrupts per sample", normal.interruptsPerSample, forced.interruptsPerSample);
+    HOST_CHECK(normal.sampleCycles < forced.sampleCycles,
+               "normal %u and forced %u cycles from the tick to the data", normal.sampleCycles, forced.sampleCycles);
+
+    return hostCheckResult("SensorModeTest");
+}
+
+// End of file
@@ -0,0 +1,124 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    SensorSimTest.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to run the whole firmware in a
+    Linux host with a BME280 on the I2C2 and a MAX7219 on the SSI2.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    main() of PFinalMain.c starts the peripherals, the interrupts, the Swis
+    and the state machine task over the models of Host/Shim. After a few
+    seconds the sensor must have been sampled, the display must show the
+    temperature and the UART must have sent its lines. SensorStreamBootTest
+    boots it with TELEMETRY_BOOT_MODE in the streaming mode. From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <string.h>
+#include "HostSim.h"
+#include "Libraries/Sensor/Sensor.h"
+#include "Libraries/Display/Display.h"
+#include "Libraries/Display/DisplayTables.h"
+#include "Libraries/RS232/Rs232.h"
+
+#define TEST_TEMPERATURE_CENTI 2437
+// The raw value of the model is the first one that reaches the temperature
+#define TEST_TOLERANCE_CENTI   2
+#define TEST_RUN_MS            3000
+
+static HostBme280 test_Sensor;
+
+int main(void)
+{
+    int32_t  expected;
+    int32_t  tenths;
+    uint8_t  index;
+
+    hostBme280Attach(&test_Sensor, I2C2_BASE, SLAVE_ADDRESS_EXT);
+    hostBme280SetTemperature(&test_Sensor, TEST_TEMPERATURE_CENTI);
+    hostMax7219Init(DISPLAY_CHAIN_LENGTH);
+
+    firmwareMain();
+    hostRunMilliseconds(TEST_RUN_MS);
+
+    // TIMER2A samples every SENSOR_TICK_MS, the normal mode of the BME280 converts on its own
+    HOST_CHECK(sensor_Samples_Total >= TEST_RUN_MS / SENSOR_TICK_MS - 2, "%u samples", sensor_Samples_Total);
+    HOST_CHECK(test_Sensor.conversions > 0, "no conversion");
+
+    // The firmware adds its compensation to the reading of the sensor
+    expected = TEST_TEMPERATURE_CENTI + sensor_Temperature_Compensation;
+    HOST_CHECK(sensor_Temperature_Average >= expected - TEST_TOLERANCE_CENTI &&
+               sensor_Temperature_Average <= expected + TEST_TOLERANCE_CENTI,
+               "average %d for %d", sensor_Temperature_Average, expected);
+
+    // The MAX7219 left its shutdown and shows the average in tenths
+    HOST_CHECK(host_Max7219[0].shutdown == 1, "shutdown register %u", host_Max7219[0].shutdown);
+    tenths = CENTIDEGREES_TO_TENTHS(sensor_Temperature_Average);
+    for(index = 0; index < DISPLAY_TEMP_TABLE_DIGITS; index++)
+    {
+        HOST_CHECK(host_Max7219[0].digits[OP_DIGIT2 - OP_DIGIT0 + index] == displayTempTable[tenths][index],
+                   "digit %u of %d tenths is 0x%02x", index, tenths, host_Max7219[0].digits[OP_DIGIT2 - OP_DIGIT0 + index]);
+    }
+
+    HOST_CHECK(host_Uart_Length > 0, "nothing on the UART");
+#ifdef TELEMETRY_BOOT_MODE
+    // The build boots in the mode of TELEMETRY_BOOT_MODE at its own rate
+    HOST_CHECK(uart_Telemetry_Mode == TELEMETRY_BOOT_MODE, "telemetry mode %d", uart_Telemetry_Mode);
+    HOST_CHECK(host_Uart_Baud == (TELEMETRY_BOOT_MODE == telemetry_Mode_Stream ? UART_SPEED_STREAM : UART_SPEED),
+               "UART0 at %u baud", host_Uart_Baud);
+#else
+    HOST_CHECK(uart_Telemetry_Mode == telemetry_Mode_Text, "telemetry mode %d", uart_Telemetry_Mode);
+    host_Uart_Capture[host_Uart_Length < HOST_UART_CAPTURE ? host_Uart_Length : HOST_UART_CAPTURE - 1] = 0;
+    HOST_CHECK(strstr((const char*)host_Uart_Capture, TEMPERATURE_MID_LABEL) != NULL, "no temperature line");
+#endif
+    HOST_CHECK(host_I2c_Overlaps == 0, "%u commands to a busy I2C master", host_I2c_Overlaps);
+
+#ifdef TELEMETRY_BOOT_MODE
+    return hostCheckResult("SensorStreamBootTest");
+#else
+    return hostCheckResult("SensorSimTest");
+#endif
+}
+
+// End of file
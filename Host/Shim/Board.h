@@ -0,0 +1,14 @@
+/* Host stand-in of Board.h of the EK-TM4C129EXL */
+
+#ifndef HOST_BOARD_H_
+#define HOST_BOARD_H_
+
+#define Board_LED0    0
+#define Board_LED_ON  1
+#define Board_LED_OFF 0
+
+void Board_initGeneral(void);
+void Board_initGPIO(void);
+void EK_TM4C129EXL_initDMA(void);
+
+#endif /* HOST_BOARD_H_ */
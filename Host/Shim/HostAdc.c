@@ -0,0 +1,293 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostAdc.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to model the sequencers 1 and 2
+    of the ADC0 reading its internal temperature sensor.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    TIMER4 or ADCProcessorTrigger() start the enabled sequencers, every
+    step of 4 takes the time of the oversampling. The sequencer 1 gives its
+    results to the ping-pong uDMA or keeps them in its FIFO, the sequencer
+    2 sends them to the digital comparators with their bands, hysteresis
+    and interrupt modes.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostModels.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_adc.h"
+#include "driverlib/adc.h"
+
+#define HOST_ADC_STEPS         4
+#define HOST_ADC_COMPARATORS   4
+// One conversion at 2 Msps
+#define HOST_ADC_STEP_CYCLES   60
+// Datasheet formula of the temperature sensor
+#define HOST_ADC_OFFSET_CENTI  14750
+#define HOST_ADC_SLOPE_CENTI   24750
+#define HOST_ADC_FULL_SCALE    4096
+
+// Bands of the comparator, the mid band is between both references
+#define HOST_ADC_BAND_LOW      0
+#define HOST_ADC_BAND_MID      1
+#define HOST_ADC_BAND_HIGH     3
+#define HOST_ADC_BAND_NONE     0xFF
+
+// Interrupt modes of the comparator
+#define HOST_ADC_CIM_ALWAYS    0
+#define HOST_ADC_CIM_ONCE      1
+#define HOST_ADC_CIM_HALWAYS   2
+#define HOST_ADC_CIM_HONCE     3
+
+typedef struct
+{
+    uint8_t  mode;
+    uint8_t  band;
+    uint32_t low;
+    uint32_t high;
+    // Hysteresis armed, the opposite band arms it again
+    bool     armed;
+    uint8_t  last;
+}HostAdcComparator;
+
+static struct
+{
+    int32_t           dieCenti;
+    uint32_t          oversample;
+    bool              enabled[HOST_ADC_STEPS];
+    uint32_t          trigger[HOST_ADC_STEPS];
+    bool              dma;
+    uint64_t          conversionEnd;
+    uint8_t           converting;
+    uint32_t          raw;
+    uint32_t          mask;
+    uint32_t          fifo[HOST_ADC_STEPS];
+    uint8_t           fifoCount;
+    HostAdcComparator comparator[HOST_ADC_COMPARATORS];
+    uint8_t           compStep[HOST_ADC_STEPS];
+    uint32_t          compStatus;
+    bool              compInterrupt;
+}host_Adc = { .dieCenti = 2500, .oversample = 1, .conversionEnd = HOST_NEVER };
+
+static uint32_t hostAdcCode(void)
+{
+    int32_t code = ((HOST_ADC_OFFSET_CENTI - host_Adc.dieCenti) * HOST_ADC_FULL_SCALE) / HOST_ADC_SLOPE_CENTI;
+
+    if(code < 0) { code = 0; }
+    else if(code > HOST_ADC_FULL_SCALE - 1) { code = HOST_ADC_FULL_SCALE - 1; }
+    return (uint32_t)code;
+}
+
+static void hostAdcCompare(HostAdcComparator* comparator, uint8_t number, uint32_t code)
+{
+    uint8_t band     = (code < comparator->low) ? HOST_ADC_BAND_LOW :
+                       (code >= comparator->high) ? HOST_ADC_BAND_HIGH : HOST_ADC_BAND_MID;
+    uint8_t opposite = (comparator->band == HOST_ADC_BAND_LOW) ? HOST_ADC_BAND_HIGH : HOST_ADC_BAND_LOW;
+    bool    fire     = false;
+
+    switch(comparator->mode)
+    {
+        case HOST_ADC_CIM_ALWAYS:
+            fire = band == comparator->band;
+            break;
+        case HOST_ADC_CIM_ONCE:
+            fire = band == comparator->band && comparator->last != comparator->band;
+            break;
+        case HOST_ADC_CIM_HALWAYS:
+        case HOST_ADC_CIM_HONCE:
+            if(band == opposite) { comparator->armed = true; }
+            fire = band == comparator->band && comparator->armed;
+            if(fire && comparator->mode == HOST_ADC_CIM_HONCE) { comparator->armed = false; }
+            break;
+    }
+    comparator->last = band;
+    if(fire) { host_Adc.compStatus |= 1u << number; }
+}
+
+void hostAdcSetDieTemperature(int32_t centi)
+{
+    host_Adc.dieCenti = centi;
+}
+
+static bool hostAdcTimed(uint8_t sequencer)
+{
+    return host_Adc.enabled[sequencer] && host_Adc.trigger[sequencer] == ADC_TRIGGER_TIMER;
+}
+
+static void hostAdcStart(uint8_t sequencer)
+{
+    host_Adc.converting    = sequencer;
+    host_Adc.conversionEnd = host_Cycles + (uint64_t)HOST_ADC_STEPS * host_Adc.oversample * HOST_ADC_STEP_CYCLES;
+}
+
+// Only one sequence at a time, a trigger that finds the ADC busy is lost
+void hostAdcTrigger(void)
+{
+    if(host_Adc.conversionEnd != HOST_NEVER) { return; }
+    if(hostAdcTimed(1)) { hostAdcStart(1); }
+    else if(hostAdcTimed(2)) { hostAdcStart(2); }
+}
+
+uint64_t hostAdcNext(void)
+{
+    return host_Adc.conversionEnd;
+}
+
+void hostAdcService(void)
+{
+    HostDmaResult result;
+    uint32_t      code;
+    uint8_t       step;
+    int           channel;
+
+    if(host_Adc.conversionEnd > host_Cycles) { return; }
+    host_Adc.conversionEnd = HOST_NEVER;
+    code = hostAdcCode();
+
+    for(step = 0; step < HOST_ADC_STEPS; step++)
+    {
+        if(host_Adc.converting == 2)
+        {
+            hostAdcCompare(&host_Adc.comparator[host_Adc.compStep[step]], host_Adc.compStep[step], code);
+            continue;
+        }
+        // Without the uDMA the results wait in the FIFO for ADCSequenceDataGet()
+        if(!host_Adc.dma)
+        {
+            host_Adc.fifo[step] = code;
+            host_Adc.fifoCount  = step + 1;
+            host_Adc.raw       |= 1u << host_Adc.converting;
+            continue;
+        }
+        // The FIFO of the sequencer is lost when the uDMA stopped
+        channel = hostDmaFind(ADC0_BASE + ADC_O_SSFIFO1, false);
+        if(channel < 0) { continue; }
+        result = hostDmaWrite(channel, code);
+        if(result == host_Dma_Done) { host_Adc.raw |= ADC_INT_DMA_SS1; }
+    }
+}
+
+bool hostAdcAsserted(uint32_t interrupt)
+{
+    if(interrupt == INT_ADC0SS1) { return (host_Adc.raw & host_Adc.mask) != 0; }
+    if(interrupt == INT_ADC0SS2) { return host_Adc.compInterrupt && host_Adc.compStatus != 0; }
+    return false;
+}
+
+void ADCSequenceConfigure(uint32_t ui32Base, uint32_t ui32SequenceNum, uint32_t ui32Trigger, uint32_t ui32Priority)
+{
+    if(ui32Base != ADC0_BASE || ui32SequenceNum >= HOST_ADC_STEPS) { hostFail("ADC sequencer %u is not modelled", ui32SequenceNum); }
+    host_Adc.trigger[ui32SequenceNum] = ui32Trigger;
+    host_Adc.conversionEnd            = HOST_NEVER;
+}
+
+void ADCProcessorTrigger(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    if(host_Adc.conversionEnd != HOST_NEVER || !host_Adc.enabled[ui32SequenceNum]) { return; }
+    hostAdcStart((uint8_t)ui32SequenceNum);
+}
+
+uint32_t ADCIntStatus(uint32_t ui32Base, uint32_t ui32SequenceNum, bool bMasked)
+{
+    uint32_t bits = (1u << ui32SequenceNum) | (ADC_INT_DMA_SS0 << ui32SequenceNum);
+
+    // A loop on the status lets the conversion end
+    if(!(host_Adc.raw & bits) && host_Adc.conversionEnd != HOST_NEVER) { hostRunCycles(host_Adc.conversionEnd - host_Cycles); }
+    return host_Adc.raw & bits & (bMasked ? host_Adc.mask : 0xFFFFFFFF);
+}
+
+void ADCIntClear(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    host_Adc.raw &= ~(1u << ui32SequenceNum);
+}
+
+int32_t ADCSequenceDataGet(uint32_t ui32Base, uint32_t ui32SequenceNum, uint32_t* pui32Buffer)
+{
+    int32_t count = host_Adc.fifoCount;
+    uint8_t step;
+
+    for(step = 0; step < host_Adc.fifoCount; step++) { pui32Buffer[step] = host_Adc.fifo[step]; }
+    host_Adc.fifoCount = 0;
+    return count;
+}
+
+void ADCSequenceStepConfigure(uint32_t ui32Base, uint32_t ui32SequenceNum, uint32_t ui32Step, uint32_t ui32Config)
+{
+    // The comparator of the step, ADC_CTL_CMP0 to ADC_CTL_CMP3
+    if(ui32Config & ADC_CTL_CMP0) { host_Adc.compStep[ui32Step] = (uint8_t)((ui32Config >> 16) & 0x3); }
+}
+
+void ADCSequenceEnable(uint32_t ui32Base, uint32_t ui32SequenceNum)        { host_Adc.enabled[ui32SequenceNum] = true; }
+void ADCSequenceDisable(uint32_t ui32Base, uint32_t ui32SequenceNum)       { host_Adc.enabled[ui32SequenceNum] = false; }
+void ADCSequenceDMAEnable(uint32_t ui32Base, uint32_t ui32SequenceNum)     { host_Adc.dma = true; }
+void ADCHardwareOversampleConfigure(uint32_t ui32Base, uint32_t ui32Factor) { host_Adc.oversample = ui32Factor; }
+void ADCIntEnableEx(uint32_t ui32Base, uint32_t ui32IntFlags)              { host_Adc.mask |= ui32IntFlags; }
+void ADCIntClearEx(uint32_t ui32Base, uint32_t ui32IntFlags)               { host_Adc.raw &= ~ui32IntFlags; }
+void ADCComparatorIntEnable(uint32_t ui32Base, uint32_t ui32SequenceNum)   { host_Adc.compInterrupt = true; }
+uint32_t ADCComparatorIntStatus(uint32_t ui32Base)                          { return host_Adc.compStatus; }
+void ADCComparatorIntClear(uint32_t ui32Base, uint32_t ui32Status)         { host_Adc.compStatus &= ~ui32Status; }
+
+void ADCComparatorConfigure(uint32_t ui32Base, uint32_t ui32Comp, uint32_t ui32Config)
+{
+    host_Adc.comparator[ui32Comp].mode = (uint8_t)(ui32Config & 0x3);
+    host_Adc.comparator[ui32Comp].band = (uint8_t)((ui32Config >> 2) & 0x3);
+}
+
+void ADCComparatorRegionSet(uint32_t ui32Base, uint32_t ui32Comp, uint32_t ui32LowRef, uint32_t ui32HighRef)
+{
+    host_Adc.comparator[ui32Comp].low  = ui32LowRef;
+    host_Adc.comparator[ui32Comp].high = ui32HighRef;
+}
+
+void ADCComparatorReset(uint32_t ui32Base, uint32_t ui32Comp, bool bTrigger, bool bInterrupt)
+{
+    if(bInterrupt)
+    {
+        host_Adc.comparator[ui32Comp].armed = true;
+        host_Adc.comparator[ui32Comp].last  = HOST_ADC_BAND_NONE;
+    }
+}
+
+// End of file
@@ -0,0 +1,448 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostBme280.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to model the BME280 sensors
+    connected to the I2C buses.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The register map, the soft reset, the forced and normal modes and the
+    typical conversion time follow the datasheet. The calibration is the one
+    of the example of the datasheet, the raw temperature is the one that the
+    integer formula turns into the temperature asked by the test.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <string.h>
+#include "HostModels.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+
+// Register map of the datasheet
+#define BME280_CALIBRATION_TP  0x88
+#define BME280_CALIBRATION_H1  0xA1
+#define BME280_CHIP_ID         0xD0
+#define BME280_RESET           0xE0
+#define BME280_CALIBRATION_H2  0xE1
+#define BME280_CTRL_HUM        0xF2
+#define BME280_STATUS          0xF3
+#define BME280_CTRL_MEAS       0xF4
+#define BME280_CONFIG          0xF5
+#define BME280_DATA            0xF7
+#define BME280_RESET_VALUE     0xB6
+#define BME280_ID_VALUE        0x60
+
+#define BME280_MODE_MASK       0x03
+#define BME280_MODE_SLEEP      0x00
+#define BME280_MODE_NORMAL     0x03
+#define BME280_STATUS_MEASURING 0x08
+
+// Values of a skipped channel
+#define BME280_SKIPPED_20_BITS 0x80000
+#define BME280_SKIPPED_16_BITS 0x8000
+
+// Start up time after the power on or the soft reset
+#define BME280_STARTUP_US      2000
+
+// Datasheet example, section 8.1 and the humidity of its typical part
+#define BME280_T1              27504
+#define BME280_T2              26435
+#define BME280_T3              (-1000)
+#define BME280_P1              36477
+#define BME280_P2              (-10685)
+#define BME280_P3              3024
+#define BME280_P4              2855
+#define BME280_P5              140
+#define BME280_P6              (-7)
+#define BME280_P7              15500
+#define BME280_P8              (-14600)
+#define BME280_P9              6000
+#define BME280_H1              75
+#define BME280_H2              362
+#define BME280_H3              0
+#define BME280_H4              324
+#define BME280_H5              50
+#define BME280_H6              30
+
+// Raw pressure and humidity of the example, about 1000 hPa and 50 %RH
+#define BME280_ADC_PRESSURE    415148
+#define BME280_ADC_HUMIDITY    30000
+
+// Pins of every I2C module, SDA can be held by the sensor
+typedef struct
+{
+    uint32_t i2cBase;
+    uint32_t gpioBase;
+    uint8_t  sclPin;
+    uint8_t  sdaPin;
+}HostI2cPins;
+
+static const HostI2cPins host_I2c_Pins[] =
+{
+    { I2C2_BASE, GPIO_PORTN_BASE, GPIO_PIN_5, GPIO_PIN_4 },
+    { I2C8_BASE, GPIO_PORTA_BASE, GPIO_PIN_2, GPIO_PIN_3 },
+    { I2C7_BASE, GPIO_PORTD_BASE, GPIO_PIN_0, GPIO_PIN_1 },
+};
+
+// Standby of t_sb in config, in us
+static const uint32_t host_Bme280_Standby[] = { 500, 62500, 125000, 250000, 500000, 1000000, 10000, 20000 };
+
+static HostBme280* host_Bme280_List = NULL;
+
+static void hostPutWord(uint8_t* registers, uint8_t address, uint16_t value)
+{
+    registers[address]     = (uint8_t)value;
+    registers[address + 1] = (uint8_t)(value >> 8);
+}
+
+static uint16_t hostWord(const uint8_t* registers, uint8_t address)
+{
+    return (uint16_t)(registers[address] | (registers[address + 1] << 8));
+}
+
+static uint8_t hostOversampling(uint8_t code)
+{
+    if(code == 0) { return 0; }
+    if(code > 5)  { code = 5; }
+    return (uint8_t)(1 << (code - 1));
+}
+
+// Typical time of the appendix B of the datasheet
+static uint64_t hostMeasureCycles(const HostBme280* sensor)
+{
+    uint8_t  temperature = hostOversampling((sensor->registers[BME280_CTRL_MEAS] >> 5) & 0x07);
+    uint8_t  pressure    = hostOversampling((sensor->registers[BME280_CTRL_MEAS] >> 2) & 0x07);
+    uint8_t  humidity    = hostOversampling(sensor->registers[BME280_CTRL_HUM] & 0x07);
+    uint32_t time        = 1000 + 2000 * temperature;
+
+    if(pressure != 0) { time += 2000 * pressure + 500; }
+    if(humidity != 0) { time += 2000 * humidity + 500; }
+    return (uint64_t)time * HOST_CYCLES_PER_US;
+}
+
+// Integer formula of the datasheet with the calibration in the registers
+static int32_t hostCompensate(const HostBme280* sensor, uint32_t raw)
+{
+    int32_t t1   = hostWord(sensor->registers, BME280_CALIBRATION_TP);
+    int32_t t2   = (int16_t)hostWord(sensor->registers, BME280_CALIBRATION_TP + 2);
+    int32_t t3   = (int16_t)hostWord(sensor->registers, BME280_CALIBRATION_TP + 4);
+    int32_t adc  = (int32_t)raw;
+    int32_t var1 = ((((adc >> 3) - (t1 << 1))) * t2) >> 11;
+    int32_t var2 = (((((adc >> 4) - t1) * ((adc >> 4) - t1)) >> 12) * t3) >> 14;
+
+    return ((var1 + var2) * 5 + 128) >> 8;
+}
+
+uint32_t hostBme280RawTemperature(const HostBme280* sensor, int32_t centi)
+{
+    uint32_t low  = 0;
+    uint32_t high = 0xFFFFF;
+    uint32_t middle;
+
+    // The formula grows with the raw value, the first raw value that reaches the temperature
+    while(low < high)
+    {
+        middle = (low + high) / 2;
+        if(hostCompensate(sensor, middle) < centi) { low = middle + 1; }
+        else { high = middle; }
+    }
+    return low;
+}
+
+// Data registers with the result of a conversion, a skipped channel gives its fixed value
+static void hostLatchData(HostBme280* sensor)
+{
+    uint8_t* data        = &sensor->registers[BME280_DATA];
+    uint32_t temperature = BME280_SKIPPED_20_BITS;
+    uint32_t pressure    = BME280_SKIPPED_20_BITS;
+    uint32_t humidity    = BME280_SKIPPED_16_BITS;
+
+    if((sensor->registers[BME280_CTRL_MEAS] >> 5) & 0x07) { temperature = hostBme280RawTemperature(sensor, sensor->temperature); }
+    if((sensor->registers[BME280_CTRL_MEAS] >> 2) & 0x07) { pressure = sensor->adcPressure; }
+    if(sensor->registers[BME280_CTRL_HUM] & 0x07)         { humidity = sensor->adcHumidity; }
+
+    data[0] = (uint8_t)(pressure >> 12);
+    data[1] = (uint8_t)(pressure >> 4);
+    data[2] = (uint8_t)(pressure << 4);
+    data[3] = (uint8_t)(temperature >> 12);
+    data[4] = (uint8_t)(temperature >> 4);
+    data[5] = (uint8_t)(temperature << 4);
+    data[6] = (uint8_t)(humidity >> 8);
+    data[7] = (uint8_t)humidity;
+    sensor->conversions++;
+}
+
+static void hostDefaults(HostBme280* sensor)
+{
+    uint8_t* registers = sensor->registers;
+
+    memset(registers, 0, HOST_BME280_REGISTERS);
+    hostPutWord(registers, BME280_CALIBRATION_TP,      BME280_T1);
+    hostPutWord(registers, BME280_CALIBRATION_TP + 2,  (uint16_t)BME280_T2);
+    hostPutWord(registers, BME280_CALIBRATION_TP + 4,  (uint16_t)BME280_T3);
+    hostPutWord(registers, BME280_CALIBRATION_TP + 6,  BME280_P1);
+    hostPutWord(registers, BME280_CALIBRATION_TP + 8,  (uint16_t)BME280_P2);
+    hostPutWord(registers, BME280_CALIBRATION_TP + 10, (uint16_t)BME280_P3);
+    hostPutWord(registers, BME280_CALIBRATION_TP + 12, (uint16_t)BME280_P4);
+    hostPutWord(registers, BME280_CALIBRATION_TP + 14, (uint16_t)BME280_P5);
+    hostPutWord(registers, BME280_CALIBRATION_TP + 16, (uint16_t)BME280_P6);
+    hostPutWord(registers, BME280_CALIBRATION_TP + 18, (uint16_t)BME280_P7);
+    hostPutWord(registers, BME280_CALIBRATION_TP + 20, (uint16_t)BME280_P8);
+    hostPutWord(registers, BME280_CALIBRATION_TP + 22, (uint16_t)BME280_P9);
+    registers[BME280_CALIBRATION_H1] = BME280_H1;
+    hostPutWord(registers, BME280_CALIBRATION_H2, BME280_H2);
+    // H4 and H5 are 12 bits and share the nibbles of 0xE5
+    registers[BME280_CALIBRATION_H2 + 2] = BME280_H3;
+    registers[BME280_CALIBRATION_H2 + 3] = (uint8_t)(BME280_H4 >> 4);
+    registers[BME280_CALIBRATION_H2 + 4] = (uint8_t)((BME280_H4 & 0x0F) | ((BME280_H5 & 0x0F) << 4));
+    registers[BME280_CALIBRATION_H2 + 5] = (uint8_t)(BME280_H5 >> 4);
+    registers[BME280_CALIBRATION_H2 + 6] = (uint8_t)BME280_H6;
+    registers[BME280_CHIP_ID] = sensor->chipId;
+    // Data of a sensor that never converted
+    hostPutWord(registers, BME280_DATA, 0x0080);
+    registers[BME280_DATA + 2] = 0x00;
+    hostPutWord(registers, BME280_DATA + 3, 0x0080);
+    registers[BME280_DATA + 5] = 0x00;
+    registers[BME280_DATA + 6] = 0x80;
+    registers[BME280_DATA + 7] = 0x00;
+
+    sensor->pointer       = 0;
+    sensor->writeIndex    = 0;
+    sensor->converting    = false;
+    sensor->conversionEnd = HOST_NEVER;
+    sensor->startupEnd    = host_Cycles + (uint64_t)BME280_STARTUP_US * HOST_CYCLES_PER_US;
+}
+
+static const HostI2cPins* hostPins(uint32_t i2cBase)
+{
+    size_t index;
+
+    for(index = 0; index < sizeof(host_I2c_Pins) / sizeof(host_I2c_Pins[0]); index++)
+    {
+        if(host_I2c_Pins[index].i2cBase == i2cBase) { return &host_I2c_Pins[index]; }
+    }
+    hostFail("I2C module 0x%08x is not modelled", i2cBase);
+    return NULL;
+}
+
+// A slave in the middle of a byte keeps SDA low until SCL finishes it
+static bool hostSdaSense(void* context, uint8_t pin)
+{
+    return !hostBme280HoldsSda((uint32_t)(uintptr_t)context);
+}
+
+static void hostSclEdge(void* context, uint8_t pin, bool level)
+{
+    if(level) { hostBme280Clock((uint32_t)(uintptr_t)context); }
+}
+
+void hostBme280Attach(HostBme280* sensor, uint32_t i2cBase, uint8_t address)
+{
+    const HostI2cPins* pins = hostPins(i2cBase);
+    HostBme280*        other;
+
+    memset(sensor, 0, sizeof(*sensor));
+    sensor->bus         = i2cBase;
+    sensor->address     = address;
+    sensor->chipId      = BME280_ID_VALUE;
+    sensor->temperature = 2500;
+    sensor->adcPressure = BME280_ADC_PRESSURE;
+    sensor->adcHumidity = BME280_ADC_HUMIDITY;
+    hostDefaults(sensor);
+    // Already powered when the firmware starts
+    sensor->startupEnd  = 0;
+
+    for(other = host_Bme280_List; other != NULL; other = other->next)
+    {
+        if(other == sensor) { hostFail("BME280 attached twice"); }
+    }
+    sensor->next     = host_Bme280_List;
+    host_Bme280_List = sensor;
+
+    hostGpioHook(pins->gpioBase, pins->sdaPin, NULL, hostSdaSense, (void*)(uintptr_t)i2cBase);
+    hostGpioHook(pins->gpioBase, pins->sclPin, hostSclEdge, NULL, (void*)(uintptr_t)i2cBase);
+}
+
+void hostBme280SetTemperature(HostBme280* sensor, int32_t centi)
+{
+    sensor->temperature = centi;
+}
+
+HostBme280* hostBme280Find(uint32_t i2cBase, uint8_t address)
+{
+    HostBme280* sensor;
+
+    for(sensor = host_Bme280_List; sensor != NULL; sensor = sensor->next)
+    {
+        if(sensor->bus == i2cBase && sensor->address == address && !sensor->absent) { return sensor; }
+    }
+    return NULL;
+}
+
+bool hostBme280Start(HostBme280* sensor, bool read)
+{
+    if(sensor->nacks != 0)
+    {
+        sensor->nacks--;
+        return false;
+    }
+    // Still starting after the reset
+    if(host_Cycles < sensor->startupEnd) { return false; }
+
+    sensor->writeIndex = 0;
+    return true;
+}
+
+bool hostBme280Write(HostBme280* sensor, uint8_t data)
+{
+    uint8_t address;
+
+    // Writes are pairs of register and value, a single byte only moves the pointer
+    if((sensor->writeIndex++ & 1) == 0)
+    {
+        sensor->pointer = data;
+        return true;
+    }
+
+    address = sensor->pointer++;
+    if(address == BME280_RESET)
+    {
+        if(data == BME280_RESET_VALUE)
+        {
+            hostDefaults(sensor);
+            sensor->resets++;
+        }
+        return true;
+    }
+    if(address != BME280_CTRL_HUM && address != BME280_CTRL_MEAS && address != BME280_CONFIG) { return true; }
+
+    sensor->registers[address] = data;
+    if(address == BME280_CTRL_MEAS)
+    {
+        // Forced mode converts once, normal mode until the next write of the mode
+        if((data & BME280_MODE_MASK) == BME280_MODE_SLEEP)
+        {
+            sensor->converting    = false;
+            sensor->conversionEnd = HOST_NEVER;
+        }
+        else
+        {
+            sensor->converting    = true;
+            sensor->conversionEnd = host_Cycles + hostMeasureCycles(sensor);
+        }
+    }
+    return true;
+}
+
+uint8_t hostBme280Read(HostBme280* sensor)
+{
+    uint8_t address = sensor->pointer++;
+
+    if(address == BME280_STATUS) { return sensor->converting ? BME280_STATUS_MEASURING : 0; }
+    return sensor->registers[address];
+}
+
+void hostBme280Stop(HostBme280* sensor)
+{
+    sensor->writeIndex = 0;
+}
+
+bool hostBme280HoldsSda(uint32_t i2cBase)
+{
+    HostBme280* sensor;
+
+    for(sensor = host_Bme280_List; sensor != NULL; sensor = sensor->next)
+    {
+        if(sensor->bus == i2cBase && sensor->sdaHeld != 0) { return true; }
+    }
+    return false;
+}
+
+void hostBme280Clock(uint32_t i2cBase)
+{
+    HostBme280* sensor;
+
+    for(sensor = host_Bme280_List; sensor != NULL; sensor = sensor->next)
+    {
+        if(sensor->bus == i2cBase && sensor->sdaHeld != 0) { sensor->sdaHeld--; }
+    }
+}
+
+uint64_t hostBme280Next(void)
+{
+    HostBme280* sensor;
+    uint64_t    next = HOST_NEVER;
+
+    for(sensor = host_Bme280_List; sensor != NULL; sensor = sensor->next)
+    {
+        if(sensor->converting && sensor->conversionEnd < next) { next = sensor->conversionEnd; }
+    }
+    return next;
+}
+
+void hostBme280Service(void)
+{
+    HostBme280* sensor;
+    uint8_t     standby;
+
+    for(sensor = host_Bme280_List; sensor != NULL; sensor = sensor->next)
+    {
+        if(!sensor->converting || sensor->conversionEnd > host_Cycles) { continue; }
+
+        hostLatchData(sensor);
+        if((sensor->registers[BME280_CTRL_MEAS] & BME280_MODE_MASK) == BME280_MODE_NORMAL)
+        {
+            standby = (sensor->registers[BME280_CONFIG] >> 5) & 0x07;
+            sensor->conversionEnd += (uint64_t)host_Bme280_Standby[standby] * HOST_CYCLES_PER_US + hostMeasureCycles(sensor);
+        }
+        else
+        {
+            // Forced mode goes back to sleep
+            sensor->registers[BME280_CTRL_MEAS] &= (uint8_t)~BME280_MODE_MASK;
+            sensor->converting    = false;
+            sensor->conversionEnd = HOST_NEVER;
+        }
+    }
+}
+
+// End of file
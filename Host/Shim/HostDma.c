@@ -0,0 +1,212 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostDma.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to model the channels of the
+    uDMA used by the project.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Every channel has its primary and alternate control structures with the
+    basic and ping-pong modes. The peripherals move one item at a time, a
+    structure that ends its transfer goes to the stop mode and the channel
+    goes on with the other one in ping-pong or turns off.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostModels.h"
+#include "driverlib/udma.h"
+
+#define HOST_DMA_CHANNELS      32
+#define HOST_DMA_CHANNEL_MASK  0x1F
+#define HOST_DMA_SIZE_16       0x11000000
+#define HOST_DMA_SRC_INC_NONE  0x0C000000
+#define HOST_DMA_DST_INC_NONE  0xC0000000
+
+typedef struct
+{
+    uint32_t  control;
+    uint32_t  mode;
+    uintptr_t source;
+    uintptr_t destination;
+    uint32_t  count;
+}HostDmaStructure;
+
+typedef struct
+{
+    HostDmaStructure structure[2];
+    bool             enabled;
+    bool             alternate;
+    uint32_t         items;
+}HostDmaChannel;
+
+static HostDmaChannel host_Dma[HOST_DMA_CHANNELS];
+
+static HostDmaStructure* hostStructure(uint32_t index)
+{
+    return &host_Dma[index & HOST_DMA_CHANNEL_MASK].structure[(index & UDMA_ALT_SELECT) ? 1 : 0];
+}
+
+static HostDmaStructure* hostActive(HostDmaChannel* channel)
+{
+    return &channel->structure[channel->alternate ? 1 : 0];
+}
+
+// The item went through the active structure, the end of the transfer moves to the next one
+static HostDmaResult hostAdvance(HostDmaChannel* channel, HostDmaStructure* active)
+{
+    uint32_t size = (active->control & HOST_DMA_SIZE_16) ? 2 : 1;
+
+    if((active->control & HOST_DMA_SRC_INC_NONE) != HOST_DMA_SRC_INC_NONE) { active->source += size; }
+    if((active->control & HOST_DMA_DST_INC_NONE) != HOST_DMA_DST_INC_NONE) { active->destination += size; }
+    active->count--;
+    channel->items++;
+    if(active->count != 0) { return host_Dma_Moved; }
+
+    if(active->mode == UDMA_MODE_PINGPONG && channel->structure[channel->alternate ? 0 : 1].mode != UDMA_MODE_STOP)
+    {
+        active->mode       = UDMA_MODE_STOP;
+        channel->alternate = !channel->alternate;
+    }
+    else
+    {
+        active->mode     = UDMA_MODE_STOP;
+        channel->enabled = false;
+    }
+    return host_Dma_Done;
+}
+
+uint32_t hostDmaItems(uint32_t channel)
+{
+    return host_Dma[channel & HOST_DMA_CHANNEL_MASK].items;
+}
+
+int hostDmaFind(uintptr_t peripheralAddress, bool toPeripheral)
+{
+    HostDmaStructure* active;
+    int               index;
+
+    for(index = 0; index < HOST_DMA_CHANNELS; index++)
+    {
+        if(!host_Dma[index].enabled) { continue; }
+        active = hostActive(&host_Dma[index]);
+        if(toPeripheral ? (active->destination == peripheralAddress) : (active->source == peripheralAddress)) { return index; }
+    }
+    return -1;
+}
+
+HostDmaResult hostDmaWrite(int channel, uint32_t value)
+{
+    HostDmaChannel*   dma = &host_Dma[channel];
+    HostDmaStructure* active;
+
+    if(!dma->enabled) { return host_Dma_Refused; }
+    active = hostActive(dma);
+    if(active->mode == UDMA_MODE_STOP || active->count == 0) { return host_Dma_Refused; }
+
+    if(active->control & HOST_DMA_SIZE_16) { *(uint16_t*)active->destination = (uint16_t)value; }
+    else { *(uint8_t*)active->destination = (uint8_t)value; }
+    return hostAdvance(dma, active);
+}
+
+HostDmaResult hostDmaRead(int channel, uint32_t* value)
+{
+    HostDmaChannel*   dma = &host_Dma[channel];
+    HostDmaStructure* active;
+
+    if(!dma->enabled) { return host_Dma_Refused; }
+    active = hostActive(dma);
+    if(active->mode == UDMA_MODE_STOP || active->count == 0) { return host_Dma_Refused; }
+
+    if(active->control & HOST_DMA_SIZE_16) { *value = *(const uint16_t*)active->source; }
+    else { *value = *(const uint8_t*)active->source; }
+    return hostAdvance(dma, active);
+}
+
+void uDMAChannelAssign(uint32_t ui32Mapping) { (void)ui32Mapping; }
+void uDMAChannelAttributeDisable(uint32_t ui32ChannelNum, uint32_t ui32Attr) { (void)ui32ChannelNum; }
+
+void uDMAChannelControlSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Control)
+{
+    hostStructure(ui32ChannelStructIndex)->control = ui32Control;
+}
+
+void uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Mode, void* pvSrcAddr,
+                            void* pvDstAddr, uint32_t ui32TransferSize)
+{
+    HostDmaStructure* structure = hostStructure(ui32ChannelStructIndex);
+
+    if(ui32TransferSize == 0 || ui32TransferSize > 1024) { hostFail("uDMA transfer of %u items", ui32TransferSize); }
+    structure->mode        = ui32Mode;
+    structure->source      = (uintptr_t)pvSrcAddr;
+    structure->destination = (uintptr_t)pvDstAddr;
+    structure->count       = ui32TransferSize;
+}
+
+void uDMAChannelEnable(uint32_t ui32ChannelNum)
+{
+    HostDmaChannel* channel = &host_Dma[ui32ChannelNum & HOST_DMA_CHANNEL_MASK];
+
+    // A basic transfer always starts on the primary structure
+    if(hostActive(channel)->mode == UDMA_MODE_STOP && channel->structure[channel->alternate ? 0 : 1].mode != UDMA_MODE_STOP)
+    {
+        channel->alternate = !channel->alternate;
+    }
+    channel->enabled = true;
+}
+
+void uDMAChannelDisable(uint32_t ui32ChannelNum)
+{
+    host_Dma[ui32ChannelNum & HOST_DMA_CHANNEL_MASK].enabled = false;
+}
+
+bool uDMAChannelIsEnabled(uint32_t ui32ChannelNum)
+{
+    return host_Dma[ui32ChannelNum & HOST_DMA_CHANNEL_MASK].enabled;
+}
+
+uint32_t uDMAChannelModeGet(uint32_t ui32ChannelStructIndex)
+{
+    return hostStructure(ui32ChannelStructIndex)->mode;
+}
+
+// End of file
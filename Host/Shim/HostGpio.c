@@ -0,0 +1,222 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostGpio.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to model the GPIO ports
+    A, D, J and N of the board.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Every pin is an input with pull-up, an output, an open drain output or
+    a pin of its peripheral. The devices see the edges of the outputs and
+    can pull the inputs low, that is how the I2C bus is cleared by software
+    and how the MAX7219 is bit-banged.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostModels.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+
+#define HOST_GPIO_PINS         8
+
+typedef struct
+{
+    uint32_t      base;
+    uint8_t       latch;
+    uint8_t       output;
+    uint8_t       openDrain;
+    uint8_t       peripheral;
+    // Level forced from outside, the buttons for example
+    uint8_t       inputs;
+    HostGpioEdge  edge[HOST_GPIO_PINS];
+    HostGpioSense sense[HOST_GPIO_PINS];
+    void*         context[HOST_GPIO_PINS];
+}HostGpioPort;
+
+static HostGpioPort host_Ports[] =
+{
+    { GPIO_PORTA_BASE, 0, 0, 0, 0, 0xFF },
+    { GPIO_PORTD_BASE, 0, 0, 0, 0, 0xFF },
+    { GPIO_PORTJ_BASE, 0, 0, 0, 0, 0xFF },
+    { GPIO_PORTN_BASE, 0, 0, 0, 0, 0xFF },
+};
+
+static HostGpioPort* hostGpioPort(uint32_t base)
+{
+    size_t index;
+
+    for(index = 0; index < sizeof(host_Ports) / sizeof(host_Ports[0]); index++)
+    {
+        if(host_Ports[index].base == base) { return &host_Ports[index]; }
+    }
+    hostFail("GPIO port 0x%08x is not modelled", base);
+    return NULL;
+}
+
+static bool hostPinLevel(const HostGpioPort* port, uint8_t index)
+{
+    uint8_t mask  = (uint8_t)(1 << index);
+    bool    level = true;
+
+    // The peripheral owns the pin, its bus is idle
+    if(port->peripheral & mask) { return true; }
+    if((port->output & mask) && !(port->openDrain & mask)) { return (port->latch & mask) != 0; }
+
+    // Open drain or input, the pull-up gives the high level
+    if(port->output & mask) { level = (port->latch & mask) != 0; }
+    if(!(port->inputs & mask)) { level = false; }
+    if(port->sense[index] != NULL && !port->sense[index](port->context[index], mask)) { level = false; }
+    return level;
+}
+
+static uint8_t hostPortLevels(const HostGpioPort* port)
+{
+    uint8_t levels = 0;
+    uint8_t index;
+
+    for(index = 0; index < HOST_GPIO_PINS; index++)
+    {
+        if(hostPinLevel(port, index)) { levels |= (uint8_t)(1 << index); }
+    }
+    return levels;
+}
+
+// Gives the devices the edges of every pin that changed
+static void hostPortEdges(HostGpioPort* port, uint8_t before)
+{
+    uint8_t after   = hostPortLevels(port);
+    uint8_t changed = before ^ after;
+    uint8_t index;
+
+    for(index = 0; index < HOST_GPIO_PINS; index++)
+    {
+        if((changed & (1 << index)) && port->edge[index] != NULL)
+        {
+            port->edge[index](port->context[index], (uint8_t)(1 << index), (after & (1 << index)) != 0);
+        }
+    }
+}
+
+static void hostPortType(uint32_t base, uint8_t pins, bool output, bool openDrain, bool peripheral)
+{
+    HostGpioPort* port   = hostGpioPort(base);
+    uint8_t       before = hostPortLevels(port);
+
+    port->output     = output     ? (port->output | pins)     : (port->output & ~pins);
+    port->openDrain  = openDrain  ? (port->openDrain | pins)  : (port->openDrain & ~pins);
+    port->peripheral = peripheral ? (port->peripheral | pins) : (port->peripheral & ~pins);
+    hostPortEdges(port, before);
+}
+
+void hostGpioHook(uint32_t base, uint8_t pin, HostGpioEdge edge, HostGpioSense sense, void* context)
+{
+    HostGpioPort* port = hostGpioPort(base);
+    uint8_t       index;
+
+    for(index = 0; index < HOST_GPIO_PINS; index++)
+    {
+        if(pin & (1 << index))
+        {
+            if(edge != NULL)  { port->edge[index]  = edge; }
+            if(sense != NULL) { port->sense[index] = sense; }
+            port->context[index] = context;
+        }
+    }
+}
+
+bool hostGpioLevel(uint32_t base, uint8_t pin)
+{
+    return (hostPortLevels(hostGpioPort(base)) & pin) != 0;
+}
+
+bool hostGpioOutput(uint32_t base, uint8_t pin)
+{
+    return hostGpioLevel(base, pin);
+}
+
+void hostGpioSetInput(uint32_t base, uint8_t pin, bool level)
+{
+    HostGpioPort* port   = hostGpioPort(base);
+    uint8_t       before = hostPortLevels(port);
+
+    port->inputs = level ? (port->inputs | pin) : (port->inputs & ~pin);
+    hostPortEdges(port, before);
+}
+
+void GPIODirModeSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32PinIO)
+{
+    hostPortType(ui32Port, ui8Pins, ui32PinIO == GPIO_DIR_MODE_OUT, false, ui32PinIO == GPIO_DIR_MODE_HW);
+}
+
+void GPIOPadConfigSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32Strength, uint32_t ui32PadType)
+{
+    (void)hostGpioPort(ui32Port);
+}
+
+void GPIOIntTypeSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32IntType) { (void)hostGpioPort(ui32Port); }
+void GPIOIntEnable(uint32_t ui32Port, uint32_t ui32IntFlags) { (void)hostGpioPort(ui32Port); }
+void GPIOPinConfigure(uint32_t ui32PinConfig) { (void)ui32PinConfig; }
+
+int32_t GPIOPinRead(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    return (int32_t)(hostPortLevels(hostGpioPort(ui32Port)) & ui8Pins);
+}
+
+void GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val)
+{
+    HostGpioPort* port   = hostGpioPort(ui32Port);
+    uint8_t       before = hostPortLevels(port);
+
+    port->latch = (uint8_t)((port->latch & ~ui8Pins) | (ui8Val & ui8Pins));
+    hostPortEdges(port, before);
+}
+
+void GPIOPinTypeGPIOInput(uint32_t ui32Port, uint8_t ui8Pins)    { hostPortType(ui32Port, ui8Pins, false, false, false); }
+void GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins)   { hostPortType(ui32Port, ui8Pins, true, false, false); }
+void GPIOPinTypeGPIOOutputOD(uint32_t ui32Port, uint8_t ui8Pins) { hostPortType(ui32Port, ui8Pins, true, true, false); }
+void GPIOPinTypeI2C(uint32_t ui32Port, uint8_t ui8Pins)          { hostPortType(ui32Port, ui8Pins, false, false, true); }
+void GPIOPinTypeI2CSCL(uint32_t ui32Port, uint8_t ui8Pins)       { hostPortType(ui32Port, ui8Pins, false, false, true); }
+void GPIOPinTypeSSI(uint32_t ui32Port, uint8_t ui8Pins)          { hostPortType(ui32Port, ui8Pins, false, false, true); }
+void GPIOPinTypeUART(uint32_t ui32Port, uint8_t ui8Pins)         { hostPortType(ui32Port, ui8Pins, false, false, true); }
+
+// End of file
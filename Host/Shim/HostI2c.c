@@ -0,0 +1,470 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostI2c.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to model the master of the
+    I2C2, I2C8 and I2C7 modules.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Every command takes the bus time of its bits at 400 kHz. The raw status
+    keeps every event until it is cleared, like I2CMRIS, and the interrupt
+    follows the bits enabled in the mask. The RX FIFO stretches the clock
+    when it is full and the uDMA empties it host_Dma_Latency cycles after a
+    byte arrives, so a read ends with its stop before the last bytes moved.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <string.h>
+#include "HostModels.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_i2c.h"
+#include "driverlib/i2c.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/udma.h"
+
+// Bits of I2CMCS
+#define HOST_I2C_RUN           0x01
+#define HOST_I2C_START         0x02
+#define HOST_I2C_STOP          0x04
+#define HOST_I2C_BURST         0x40
+
+#define HOST_I2C_FIFO_LENGTH   8
+#define HOST_I2C_FIFO_DMA      0x20000000
+#define HOST_I2C_TRIGGER_SHIFT 16
+#define HOST_I2C_TRIGGER_MASK  0x7
+
+// Bits of the bus for every step
+#define HOST_I2C_ADDRESS_BITS  10
+#define HOST_I2C_BYTE_BITS     9
+#define HOST_I2C_STOP_BITS     1
+
+typedef enum
+{
+    host_I2c_Idle    ,
+    host_I2c_Address ,
+    host_I2c_Write   ,
+    host_I2c_Read    ,
+    host_I2c_Stop
+}HostI2cStep;
+
+typedef struct
+{
+    uint32_t    base;
+    uint32_t    interrupt;
+    uint32_t    peripheral;
+    uint32_t    raw;
+    uint32_t    mask;
+    uint32_t    bitCycles;
+    uint32_t    fifoConfig;
+    uint8_t     address;
+    bool        receive;
+    uint8_t     data;
+    uint8_t     received;
+    uint8_t     burst;
+    uint32_t    command;
+    HostI2cStep step;
+    uint64_t    stepEnd;
+    HostBme280* device;
+    bool        acked;
+    // The bus stays taken between the commands of a burst
+    bool        holding;
+    uint8_t     remaining;
+    uint8_t     fifo[HOST_I2C_FIFO_LENGTH];
+    uint8_t     fifoCount;
+    // A byte waiting for room in the FIFO, SCL is held low
+    bool        stretched;
+    uint8_t     stretchedByte;
+    uint64_t    dmaDue;
+}HostI2c;
+
+uint32_t host_I2c_Overlaps = 0;
+uint32_t host_Dma_Latency  = 600;
+
+static HostI2c host_I2c[] =
+{
+    { .base = I2C2_BASE, .interrupt = INT_I2C2, .peripheral = SYSCTL_PERIPH_I2C2, .stepEnd = HOST_NEVER, .dmaDue = HOST_NEVER },
+    { .base = I2C8_BASE, .interrupt = INT_I2C8, .peripheral = SYSCTL_PERIPH_I2C8, .stepEnd = HOST_NEVER, .dmaDue = HOST_NEVER },
+    { .base = I2C7_BASE, .interrupt = INT_I2C7, .peripheral = SYSCTL_PERIPH_I2C7, .stepEnd = HOST_NEVER, .dmaDue = HOST_NEVER },
+};
+
+#define HOST_I2C_MODULES       (sizeof(host_I2c) / sizeof(host_I2c[0]))
+
+static HostI2c* hostI2c(uint32_t base)
+{
+    size_t index;
+
+    for(index = 0; index < HOST_I2C_MODULES; index++)
+    {
+        if(host_I2c[index].base == base) { return &host_I2c[index]; }
+    }
+    hostFail("I2C module 0x%08x is not modelled", base);
+    return NULL;
+}
+
+static void hostI2cClear(HostI2c* module)
+{
+    module->raw        = 0;
+    module->mask       = 0;
+    module->fifoConfig = 0;
+    module->command    = 0;
+    module->step       = host_I2c_Idle;
+    module->stepEnd    = HOST_NEVER;
+    module->device     = NULL;
+    module->holding    = false;
+    module->fifoCount  = 0;
+    module->stretched  = false;
+    module->dmaDue     = HOST_NEVER;
+}
+
+static void hostStep(HostI2c* module, HostI2cStep step, uint32_t bits)
+{
+    module->step    = step;
+    module->stepEnd = host_Cycles + (uint64_t)bits * module->bitCycles;
+}
+
+static void hostIdle(HostI2c* module)
+{
+    module->step    = host_I2c_Idle;
+    module->stepEnd = HOST_NEVER;
+}
+
+// A NACK of the address or of a byte, the stop is only sent if the command had it
+static void hostNack(HostI2c* module)
+{
+    module->raw |= I2C_MASTER_INT_NACK | I2C_MASTER_INT_DATA;
+    if(module->command & HOST_I2C_STOP)
+    {
+        if(module->device != NULL) { hostBme280Stop(module->device); }
+        module->raw    |= I2C_MASTER_INT_STOP;
+        module->holding = false;
+    }
+    else { module->holding = true; }
+    hostIdle(module);
+}
+
+static int hostDmaChannel(HostI2c* module)
+{
+    if(!(module->fifoConfig & HOST_I2C_FIFO_DMA)) { return -1; }
+    return hostDmaFind(module->base + I2C_O_FIFODATA, false);
+}
+
+static void hostPush(HostI2c* module, uint8_t data)
+{
+    uint8_t trigger = (uint8_t)((module->fifoConfig >> HOST_I2C_TRIGGER_SHIFT) & HOST_I2C_TRIGGER_MASK);
+
+    module->fifo[module->fifoCount++] = data;
+    if(module->fifoCount >= trigger) { module->raw |= I2C_MASTER_INT_RX_FIFO_REQ; }
+    if(hostDmaChannel(module) >= 0 && module->dmaDue == HOST_NEVER) { module->dmaDue = host_Cycles + host_Dma_Latency; }
+}
+
+static void hostReceived(HostI2c* module, uint8_t data)
+{
+    hostPush(module, data);
+    module->remaining--;
+    if(module->remaining == 0) { hostStep(module, host_I2c_Stop, HOST_I2C_STOP_BITS); }
+    else { hostStep(module, host_I2c_Read, HOST_I2C_BYTE_BITS); }
+}
+
+static bool hostPop(HostI2c* module, uint8_t* data)
+{
+    if(module->fifoCount == 0) { return false; }
+
+    *data = module->fifo[0];
+    module->fifoCount--;
+    memmove(module->fifo, &module->fifo[1], module->fifoCount);
+    // The clock was held for the byte that did not fit
+    if(module->stretched)
+    {
+        module->stretched = false;
+        hostReceived(module, module->stretchedByte);
+    }
+    return true;
+}
+
+static void hostStepDone(HostI2c* module)
+{
+    uint8_t data;
+
+    switch(module->step)
+    {
+        case host_I2c_Address:
+            if(!module->acked) { hostNack(module); }
+            else if(module->receive) { hostStep(module, host_I2c_Read, HOST_I2C_BYTE_BITS); }
+            else { hostStep(module, host_I2c_Write, HOST_I2C_BYTE_BITS); }
+            break;
+        case host_I2c_Write:
+            if(!hostBme280Write(module->device, module->data)) { hostNack(module); }
+            else if(module->command & HOST_I2C_STOP) { hostStep(module, host_I2c_Stop, HOST_I2C_STOP_BITS); }
+            else
+            {
+                module->raw    |= I2C_MASTER_INT_DATA;
+                module->holding = true;
+                hostIdle(module);
+            }
+            break;
+        case host_I2c_Read:
+            data = hostBme280Read(module->device);
+            // Without the FIFO every byte waits in I2CMDR, the command says if the stop follows
+            if(!(module->command & HOST_I2C_BURST))
+            {
+                module->received = data;
+                if(module->command & HOST_I2C_STOP) { hostStep(module, host_I2c_Stop, HOST_I2C_STOP_BITS); }
+                else
+                {
+                    module->raw    |= I2C_MASTER_INT_DATA;
+                    module->holding = true;
+                    hostIdle(module);
+                }
+            }
+            else if(module->fifoCount >= HOST_I2C_FIFO_LENGTH)
+            {
+                // Still busy, the byte waits on the bus
+                module->stretched     = true;
+                module->stretchedByte = data;
+                module->stepEnd       = HOST_NEVER;
+            }
+            else { hostReceived(module, data); }
+            break;
+        case host_I2c_Stop:
+            hostBme280Stop(module->device);
+            module->raw    |= I2C_MASTER_INT_DATA | I2C_MASTER_INT_STOP;
+            module->holding = false;
+            hostIdle(module);
+            break;
+        default:
+            break;
+    }
+}
+
+static void hostDmaService(HostI2c* module)
+{
+    int           channel = hostDmaChannel(module);
+    HostDmaResult result  = host_Dma_Refused;
+    uint8_t       data;
+
+    module->dmaDue = HOST_NEVER;
+    if(channel < 0) { return; }
+
+    while(module->fifoCount != 0)
+    {
+        result = hostDmaWrite(channel, module->fifo[0]);
+        if(result == host_Dma_Refused) { break; }
+        (void)hostPop(module, &data);
+        if(result == host_Dma_Done)
+        {
+            module->raw |= I2C_MASTER_INT_RX_DMA_DONE;
+            break;
+        }
+    }
+}
+
+uint64_t hostI2cNext(void)
+{
+    uint64_t next = HOST_NEVER;
+    size_t   index;
+
+    for(index = 0; index < HOST_I2C_MODULES; index++)
+    {
+        if(host_I2c[index].stepEnd < next) { next = host_I2c[index].stepEnd; }
+        if(host_I2c[index].dmaDue < next)  { next = host_I2c[index].dmaDue; }
+    }
+    return next;
+}
+
+void hostI2cService(void)
+{
+    HostI2c* module;
+    size_t   index;
+
+    for(index = 0; index < HOST_I2C_MODULES; index++)
+    {
+        module = &host_I2c[index];
+        if(module->dmaDue <= host_Cycles) { hostDmaService(module); }
+        if(module->stepEnd <= host_Cycles) { hostStepDone(module); }
+    }
+}
+
+bool hostI2cAsserted(uint32_t interrupt)
+{
+    size_t index;
+
+    for(index = 0; index < HOST_I2C_MODULES; index++)
+    {
+        if(host_I2c[index].interrupt == interrupt) { return (host_I2c[index].raw & host_I2c[index].mask) != 0; }
+    }
+    return false;
+}
+
+void hostI2cPeripheralReset(uint32_t peripheral)
+{
+    size_t index;
+
+    for(index = 0; index < HOST_I2C_MODULES; index++)
+    {
+        if(host_I2c[index].peripheral == peripheral) { hostI2cClear(&host_I2c[index]); }
+    }
+}
+
+void I2CMasterInitExpClk(uint32_t ui32Base, uint32_t ui32I2CClk, bool bFast)
+{
+    hostI2c(ui32Base)->bitCycles = ui32I2CClk / (bFast ? 400000 : 100000);
+}
+
+void I2CMasterTimeoutSet(uint32_t ui32Base, uint32_t ui32Value) { (void)hostI2c(ui32Base); }
+
+bool I2CMasterBusBusy(uint32_t ui32Base)
+{
+    HostI2c* module = hostI2c(ui32Base);
+    bool     busy   = module->step != host_I2c_Idle || module->holding;
+
+    // A loop on the bus lets the bits go by
+    if(busy) { hostRunCycles(module->bitCycles); }
+    return busy;
+}
+
+void I2CMasterControl(uint32_t ui32Base, uint32_t ui32Cmd)
+{
+    HostI2c* module = hostI2c(ui32Base);
+
+    if(module->step != host_I2c_Idle)
+    {
+        host_I2c_Overlaps++;
+        return;
+    }
+    if(module->bitCycles == 0) { hostFail("I2C 0x%08x used before I2CMasterInitExpClk()", ui32Base); }
+
+    module->command = ui32Cmd;
+    // Only the stop, after an error of a burst
+    if(!(ui32Cmd & (HOST_I2C_RUN | HOST_I2C_BURST)))
+    {
+        if(module->holding && module->device != NULL) { hostBme280Stop(module->device); }
+        if(module->holding) { module->raw |= I2C_MASTER_INT_STOP; }
+        module->holding = false;
+        return;
+    }
+
+    if(ui32Cmd & HOST_I2C_START)
+    {
+        // A slave holding SDA low makes the master lose the start
+        if(hostBme280HoldsSda(ui32Base))
+        {
+            module->raw    |= I2C_MASTER_INT_ARB_LOST | I2C_MASTER_INT_DATA;
+            module->holding = false;
+            return;
+        }
+        module->device    = hostBme280Find(ui32Base, module->address);
+        module->acked     = module->device != NULL && hostBme280Start(module->device, module->receive);
+        module->remaining = (ui32Cmd & HOST_I2C_BURST) ? module->burst : 1;
+        hostStep(module, host_I2c_Address, HOST_I2C_ADDRESS_BITS);
+        return;
+    }
+
+    if(!module->holding || module->device == NULL) { hostFail("I2C 0x%08x continues a burst it does not hold", ui32Base); }
+    hostStep(module, module->receive ? host_I2c_Read : host_I2c_Write, HOST_I2C_BYTE_BITS);
+}
+
+void I2CMasterDataPut(uint32_t ui32Base, uint8_t ui8Data)
+{
+    hostI2c(ui32Base)->data = ui8Data;
+}
+
+uint32_t I2CMasterDataGet(uint32_t ui32Base)
+{
+    return hostI2c(ui32Base)->received;
+}
+
+void I2CMasterSlaveAddrSet(uint32_t ui32Base, uint8_t ui8SlaveAddr, bool bReceive)
+{
+    HostI2c* module = hostI2c(ui32Base);
+
+    module->address = ui8SlaveAddr;
+    module->receive = bReceive;
+}
+
+void I2CMasterBurstLengthSet(uint32_t ui32Base, uint8_t ui8Length)
+{
+    hostI2c(ui32Base)->burst = ui8Length;
+}
+
+void I2CMasterIntEnableEx(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    hostI2c(ui32Base)->mask |= ui32IntFlags;
+}
+
+void I2CMasterIntDisableEx(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    hostI2c(ui32Base)->mask &= ~ui32IntFlags;
+}
+
+void I2CMasterIntClearEx(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    hostI2c(ui32Base)->raw &= ~ui32IntFlags;
+}
+
+uint32_t I2CMasterIntStatusEx(uint32_t ui32Base, bool bMasked)
+{
+    HostI2c* module = hostI2c(ui32Base);
+
+    return bMasked ? (module->raw & module->mask) : module->raw;
+}
+
+void I2CRxFIFOConfigSet(uint32_t ui32Base, uint32_t ui32Config)
+{
+    hostI2c(ui32Base)->fifoConfig = ui32Config;
+}
+
+void I2CRxFIFOFlush(uint32_t ui32Base)
+{
+    HostI2c* module = hostI2c(ui32Base);
+
+    module->fifoCount = 0;
+    module->dmaDue    = HOST_NEVER;
+}
+
+uint32_t I2CFIFODataGetNonBlocking(uint32_t ui32Base, uint8_t* pui8Data)
+{
+    return hostPop(hostI2c(ui32Base), pui8Data) ? 1 : 0;
+}
+
+// End of file
@@ -0,0 +1,141 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostMax7219.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to model the chain of MAX7219
+    of the display.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Every MAX7219 has a shift register of 16 bits, the bit that leaves one
+    enters the next of the chain. The rising edge of LOAD latches the word
+    of every one of them, the NOOP word leaves the registers as they were.
+    The bit-banged transport clocks the chain with PD3 and PD1 and latches
+    it with PN3, SSI2 does it from HostSsi.c.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <string.h>
+#include "HostModels.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+
+// Registers of the datasheet
+#define HOST_MAX7219_NOOP        0x0
+#define HOST_MAX7219_DIGIT0      0x1
+#define HOST_MAX7219_DIGIT7      0x8
+#define HOST_MAX7219_DECODE      0x9
+#define HOST_MAX7219_INTENSITY   0xA
+#define HOST_MAX7219_SCAN_LIMIT  0xB
+#define HOST_MAX7219_SHUTDOWN    0xC
+#define HOST_MAX7219_TEST        0xF
+
+HostMax7219 host_Max7219[HOST_MAX7219_CHAIN_MAX];
+uint8_t     host_Max7219_Length = 1;
+uint32_t    host_Max7219_Loads  = 0;
+
+void hostMax7219Shift(bool bit)
+{
+    bool    carry = bit;
+    bool    out;
+    uint8_t index;
+
+    for(index = 0; index < host_Max7219_Length; index++)
+    {
+        out                        = (host_Max7219[index].shift & 0x8000) != 0;
+        host_Max7219[index].shift  = (uint16_t)((host_Max7219[index].shift << 1) | (carry ? 1 : 0));
+        carry                      = out;
+    }
+}
+
+void hostMax7219Load(void)
+{
+    HostMax7219* chip;
+    uint8_t      address;
+    uint8_t      value;
+    uint8_t      index;
+
+    host_Max7219_Loads++;
+    for(index = 0; index < host_Max7219_Length; index++)
+    {
+        chip    = &host_Max7219[index];
+        address = (uint8_t)((chip->shift >> 8) & 0x0F);
+        value   = (uint8_t)chip->shift;
+
+        if(address == HOST_MAX7219_NOOP) { continue; }
+        chip->writes++;
+        if(address >= HOST_MAX7219_DIGIT0 && address <= HOST_MAX7219_DIGIT7)
+        {
+            chip->digits[address - HOST_MAX7219_DIGIT0] = value;
+        }
+        else if(address == HOST_MAX7219_DECODE)     { chip->decodeMode  = value; }
+        else if(address == HOST_MAX7219_INTENSITY)  { chip->intensity   = value; }
+        else if(address == HOST_MAX7219_SCAN_LIMIT) { chip->scanLimit   = value; }
+        else if(address == HOST_MAX7219_SHUTDOWN)   { chip->shutdown    = value; }
+        else if(address == HOST_MAX7219_TEST)       { chip->displayTest = value; }
+    }
+}
+
+// CLK on PD3, the DIN of the first MAX7219 is PD1
+static void hostMax7219Clock(void* context, uint8_t pin, bool level)
+{
+    if(level) { hostMax7219Shift(hostGpioLevel(GPIO_PORTD_BASE, GPIO_PIN_1)); }
+}
+
+// LOAD on PN3
+static void hostMax7219Latch(void* context, uint8_t pin, bool level)
+{
+    if(level) { hostMax7219Load(); }
+}
+
+void hostMax7219Init(uint8_t length)
+{
+    if(length == 0 || length > HOST_MAX7219_CHAIN_MAX) { hostFail("chain of %u MAX7219", length); }
+
+    memset(host_Max7219, 0, sizeof(host_Max7219));
+    host_Max7219_Length = length;
+    host_Max7219_Loads  = 0;
+    hostGpioHook(GPIO_PORTD_BASE, GPIO_PIN_3, hostMax7219Clock, NULL, NULL);
+    hostGpioHook(GPIO_PORTN_BASE, GPIO_PIN_3, hostMax7219Latch, NULL, NULL);
+}
+
+// End of file
@@ -0,0 +1,152 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostModels.h
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a header file for C language. The purpose is to
+    connect the models of the peripherals to the core of the simulation.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Every model tells the core when its next event is due and services
+    the events that are due, the core then runs the interrupts that the
+    models raise. Only the files of Host/Shim include this header.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#ifndef HOST_SHIM_HOSTMODELS_H_
+#define HOST_SHIM_HOSTMODELS_H_
+
+/* *****************************************************************
+ *                        Included files
+ * *****************************************************************
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "HostSim.h"
+
+/* *****************************************************************
+ *                        Macros
+ * *****************************************************************
+ */
+
+// No event pending in a model
+#define HOST_NEVER             UINT64_MAX
+
+/* *****************************************************************
+ *                        Definitions
+ * *****************************************************************
+ */
+
+// What the uDMA did with one item of a peripheral
+typedef enum
+{
+    host_Dma_Refused ,
+    host_Dma_Moved   ,
+    host_Dma_Done
+}HostDmaResult;
+
+// Called when a pin driven by the micro changes its level
+typedef void (*HostGpioEdge)(void* context, uint8_t pin, bool level);
+// Level that a device forces on a pin, false pulls it low
+typedef bool (*HostGpioSense)(void* context, uint8_t pin);
+
+/* *****************************************************************
+ *                       Function prototypes
+ * *****************************************************************
+ */
+
+// Core, HostSim.c
+void     hostFail(const char* format, ...);
+void     hostDispatch(void);
+
+// Events of every model, HOST_NEVER when there is none
+uint64_t hostTimerNext(void);
+void     hostTimerService(void);
+uint64_t hostI2cNext(void);
+void     hostI2cService(void);
+uint64_t hostBme280Next(void);
+void     hostBme280Service(void);
+uint64_t hostSsiNext(void);
+void     hostSsiService(void);
+uint64_t hostUartNext(void);
+void     hostUartService(void);
+uint64_t hostAdcNext(void);
+void     hostAdcService(void);
+
+// Interrupt lines that follow the status of their peripheral
+bool     hostTimerAsserted(uint32_t interrupt);
+bool     hostI2cAsserted(uint32_t interrupt);
+bool     hostSsiAsserted(uint32_t interrupt);
+bool     hostUartAsserted(uint32_t interrupt);
+bool     hostAdcAsserted(uint32_t interrupt);
+
+// Reset of a module by SysCtlPeripheralReset()
+void     hostI2cPeripheralReset(uint32_t peripheral);
+
+// TIMER4 starts the sequencers of the ADC
+void     hostAdcTrigger(void);
+
+// GPIO, HostGpio.c
+void     hostGpioHook(uint32_t port, uint8_t pin, HostGpioEdge edge, HostGpioSense sense, void* context);
+bool     hostGpioLevel(uint32_t port, uint8_t pin);
+
+// uDMA, HostDma.c. The peripheral finds its channel by the address of its FIFO,
+// host_Dma_Done ends the transfer of the control structure
+int      hostDmaFind(uintptr_t peripheralAddress, bool toPeripheral);
+HostDmaResult hostDmaWrite(int channel, uint32_t value);
+HostDmaResult hostDmaRead(int channel, uint32_t* value);
+
+// BME280 models on the I2C buses, HostBme280.c
+HostBme280* hostBme280Find(uint32_t i2cBase, uint8_t address);
+bool     hostBme280Start(HostBme280* sensor, bool read);
+bool     hostBme280Write(HostBme280* sensor, uint8_t data);
+uint8_t  hostBme280Read(HostBme280* sensor);
+void     hostBme280Stop(HostBme280* sensor);
+bool     hostBme280HoldsSda(uint32_t i2cBase);
+void     hostBme280Clock(uint32_t i2cBase);
+
+// MAX7219 chain, HostMax7219.c
+void     hostMax7219Shift(bool bit);
+void     hostMax7219Load(void);
+
+#endif /* HOST_SHIM_HOSTMODELS_H_ */
@@ -0,0 +1,554 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostSim.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to keep the time of the
+    simulation and to run the interrupts, the Swis and the task.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Also the stand-ins of SysCtl, the interrupt controller, the core
+    registers, TI-RTOS and the board that have no model of their own.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <stdarg.h>
+#include <ucontext.h>
+#include "HostModels.h"
+#include "inc/hw_types.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/gpio.h"
+#include <xdc/std.h>
+#include <xdc/runtime/System.h>
+#include <xdc/runtime/Error.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/hal/Hwi.h>
+#include <ti/sysbios/knl/Swi.h>
+#include <ti/sysbios/knl/Task.h>
+#include <ti/drivers/GPIO.h>
+#include "Board.h"
+
+// Swis and tasks the firmware can create
+#define HOST_SWI_MAX           8
+#define HOST_TASK_MAX          4
+// Registers written with HWREG, the cycle counter is computed
+#define HOST_REGISTER_MAX      16
+#define HOST_DWT_CYCCNT        0xE0001004
+// An interrupt that runs this many times without time passing never clears its source
+#define HOST_INTERRUPT_STORM   100000
+#define HOST_TASK_STACK        (256 * 1024)
+
+struct HostHwi
+{
+    Hwi_FuncPtr fxn;
+    UArg        arg;
+};
+
+struct HostSwi
+{
+    Swi_FuncPtr fxn;
+    UArg        arg0;
+    UArg        arg1;
+    bool        posted;
+    uint32_t    order;
+};
+
+// Every task keeps its own stack, Task_sleep() gives the control back to the scheduler
+typedef struct
+{
+    Task_Struct* task;
+    ucontext_t   context;
+    bool         created;
+    uint64_t     wake;
+}HostTask;
+
+typedef struct
+{
+    uint64_t (*next)(void);
+    void     (*service)(void);
+}HostModel;
+
+static const HostModel hostModels[] =
+{
+    { hostTimerNext,  hostTimerService  },
+    { hostI2cNext,    hostI2cService    },
+    { hostBme280Next, hostBme280Service },
+    { hostSsiNext,    hostSsiService    },
+    { hostUartNext,   hostUartService   },
+    { hostAdcNext,    hostAdcService    },
+};
+
+uint64_t host_Cycles   = 0;
+uint32_t host_Checks   = 0;
+uint32_t host_Failures = 0;
+
+static struct HostHwi host_Hwis[NUM_INTERRUPTS];
+static bool           host_Enabled[NUM_INTERRUPTS];
+static bool           host_Pending[NUM_INTERRUPTS];
+static struct HostSwi host_Swis[HOST_SWI_MAX];
+static uint8_t        host_Swi_Count   = 0;
+static uint32_t       host_Swi_Order   = 0;
+// TI-RTOS starts with the interrupts off, the Swis and the task wait for BIOS_start()
+static bool           host_Masked      = true;
+static bool           host_Started     = false;
+static uint32_t       host_Hwi_Depth   = 0;
+static uint32_t       host_Swi_Depth   = 0;
+static uint64_t       host_Storm_Cycle = 0;
+static uint32_t       host_Storm_Count = 0;
+
+static HostTask       host_Tasks[HOST_TASK_MAX];
+static uint8_t        host_Task_Count    = 0;
+static HostTask*      host_Task_Current  = NULL;
+static ucontext_t     host_Test_Context;
+
+static struct
+{
+    uint32_t address;
+    uint32_t value;
+}host_Registers[HOST_REGISTER_MAX];
+static uint8_t  host_Register_Count = 0;
+static uint32_t host_Cycle_Register = 0;
+
+void hostFail(const char* format, ...)
+{
+    va_list arguments;
+
+    printf("simulation error at %llu cycles: ", (unsigned long long)host_Cycles);
+    va_start(arguments, format);
+    vprintf(format, arguments);
+    va_end(arguments);
+    printf("\n");
+    exit(2);
+}
+
+static bool hostAsserted(uint32_t interrupt)
+{
+    return host_Pending[interrupt] || hostTimerAsserted(interrupt) || hostI2cAsserted(interrupt) ||
+           hostSsiAsserted(interrupt) || hostUartAsserted(interrupt) || hostAdcAsserted(interrupt);
+}
+
+// Same priority for all, the lowest vector goes first like in the NVIC
+static int hostNextInterrupt(void)
+{
+    uint32_t interrupt;
+
+    for(interrupt = 0; interrupt < NUM_INTERRUPTS; interrupt++)
+    {
+        if(host_Enabled[interrupt] && host_Hwis[interrupt].fxn != NULL && hostAsserted(interrupt))
+        {
+            return (int)interrupt;
+        }
+    }
+    return -1;
+}
+
+static struct HostSwi* hostNextSwi(void)
+{
+    struct HostSwi* next = NULL;
+    uint8_t         index;
+
+    for(index = 0; index < host_Swi_Count; index++)
+    {
+        if(host_Swis[index].posted && (next == NULL || host_Swis[index].order < next->order))
+        {
+            next = &host_Swis[index];
+        }
+    }
+    return next;
+}
+
+void hostDispatch(void)
+{
+    struct HostSwi* swi;
+    int             interrupt;
+
+    // A Hwi runs to the end, the same priority does not preempt it
+    if(host_Masked || host_Hwi_Depth != 0) { return; }
+
+    for(;;)
+    {
+        interrupt = hostNextInterrupt();
+        if(interrupt >= 0)
+        {
+            if(host_Storm_Cycle != host_Cycles) {
+                host_Storm_Cycle = host_Cycles;
+                host_Storm_Count = 0;
+            }
+            if(++host_Storm_Count > HOST_INTERRUPT_STORM) { hostFail("interrupt %d is never cleared", interrupt); }
+
+            host_Pending[interrupt] = false;
+            host_Hwi_Depth++;
+            host_Hwis[interrupt].fxn(host_Hwis[interrupt].arg);
+            host_Hwi_Depth--;
+            continue;
+        }
+        // The Swis run after the Hwis and one Swi does not preempt another
+        swi = hostNextSwi();
+        if(swi != NULL && host_Started && host_Swi_Depth == 0)
+        {
+            swi->posted = false;
+            host_Swi_Depth++;
+            swi->fxn(swi->arg0, swi->arg1);
+            host_Swi_Depth--;
+            continue;
+        }
+        break;
+    }
+}
+
+static uint64_t hostNextEvent(void)
+{
+    uint64_t next = HOST_NEVER;
+    uint64_t event;
+    size_t   index;
+
+    for(index = 0; index < sizeof(hostModels) / sizeof(hostModels[0]); index++)
+    {
+        event = hostModels[index].next();
+        if(event < next) { next = event; }
+    }
+    return next;
+}
+
+void hostRunCycles(uint64_t cycles)
+{
+    uint64_t end = host_Cycles + cycles;
+    uint64_t next;
+    size_t   index;
+
+    for(;;)
+    {
+        next = hostNextEvent();
+        if(next > end) { break; }
+        if(next > host_Cycles) { host_Cycles = next; }
+        for(index = 0; index < sizeof(hostModels) / sizeof(hostModels[0]); index++)
+        {
+            hostModels[index].service();
+        }
+        hostDispatch();
+    }
+    // An interrupt that waited inside this run may already be past the end
+    if(host_Cycles < end) { host_Cycles = end; }
+    hostDispatch();
+}
+
+static void hostTaskEntry(void)
+{
+    host_Task_Current->task->fxn(host_Task_Current->task->arg0, host_Task_Current->task->arg1);
+    hostFail("a task returned");
+}
+
+static void hostTaskCreate(HostTask* task)
+{
+    getcontext(&task->context);
+    task->context.uc_stack.ss_sp   = malloc(HOST_TASK_STACK);
+    task->context.uc_stack.ss_size = HOST_TASK_STACK;
+    task->context.uc_link          = NULL;
+    makecontext(&task->context, hostTaskEntry, 0);
+    task->created = true;
+}
+
+// The first to wake up, the higher priority and then the first created on a tie
+static HostTask* hostNextTask(void)
+{
+    HostTask* next = &host_Tasks[0];
+    uint8_t   index;
+
+    for(index = 1; index < host_Task_Count; index++)
+    {
+        if(host_Tasks[index].wake < next->wake ||
+           (host_Tasks[index].wake == next->wake && host_Tasks[index].task->priority > next->task->priority))
+        {
+            next = &host_Tasks[index];
+        }
+    }
+    return next;
+}
+
+void hostRunMilliseconds(uint32_t milliseconds)
+{
+    uint64_t  deadline = host_Cycles + (uint64_t)milliseconds * HOST_CYCLES_PER_MS;
+    HostTask* task;
+
+    if(host_Task_Count == 0 || !host_Started || host_Task_Current != NULL)
+    {
+        hostRunCycles((uint64_t)milliseconds * HOST_CYCLES_PER_MS);
+        return;
+    }
+
+    // The tasks loop forever, each Task_sleep() comes back here
+    for(;;)
+    {
+        task = hostNextTask();
+        if(task->wake > deadline) { break; }
+        if(task->wake > host_Cycles) { hostRunCycles(task->wake - host_Cycles); }
+
+        if(!task->created) { hostTaskCreate(task); }
+        host_Task_Current = task;
+        swapcontext(&host_Test_Context, &task->context);
+        host_Task_Current = NULL;
+    }
+    if(host_Cycles < deadline) { hostRunCycles(deadline - host_Cycles); }
+}
+
+bool hostRunUntil(bool (*condition)(void), uint32_t milliseconds)
+{
+    uint64_t end = host_Cycles + (uint64_t)milliseconds * HOST_CYCLES_PER_MS;
+
+    // Steps of 10 us, the conditions are read between the events
+    while(!condition())
+    {
+        if(host_Cycles >= end) { return false; }
+        hostRunCycles(10 * HOST_CYCLES_PER_US);
+    }
+    return true;
+}
+
+int hostCheckResult(const char* name)
+{
+    printf("%s: %u checks, %u failed\n", name, host_Checks, host_Failures);
+    return (host_Failures == 0 && host_Checks != 0) ? 0 : 1;
+}
+
+volatile uint32_t* hostRegister(uint32_t address)
+{
+    uint8_t index;
+
+    if(address == HOST_DWT_CYCCNT)
+    {
+        host_Cycle_Register = (uint32_t)host_Cycles;
+        return &host_Cycle_Register;
+    }
+    for(index = 0; index < host_Register_Count; index++)
+    {
+        if(host_Registers[index].address == address) { return &host_Registers[index].value; }
+    }
+    if(host_Register_Count >= HOST_REGISTER_MAX) { hostFail("register 0x%08x has no room", address); }
+    host_Registers[host_Register_Count].address = address;
+    host_Registers[host_Register_Count].value   = 0;
+    return &host_Registers[host_Register_Count++].value;
+}
+
+/* *****************************************************************
+ *                        SysCtl and interrupts
+ * *****************************************************************
+ */
+
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral)  { (void)ui32Peripheral; }
+void SysCtlPeripheralDisable(uint32_t ui32Peripheral) { (void)ui32Peripheral; }
+bool SysCtlPeripheralReady(uint32_t ui32Peripheral)   { (void)ui32Peripheral; return true; }
+
+void SysCtlPeripheralReset(uint32_t ui32Peripheral)
+{
+    hostI2cPeripheralReset(ui32Peripheral);
+}
+
+void SysCtlDelay(uint32_t ui32Count)
+{
+    hostRunCycles((uint64_t)ui32Count * 3);
+}
+
+bool IntMasterEnable(void)
+{
+    bool masked = host_Masked;
+
+    host_Masked = false;
+    // A source that came while masked is taken now
+    hostDispatch();
+    return masked;
+}
+
+bool IntMasterDisable(void)
+{
+    bool masked = host_Masked;
+
+    host_Masked = true;
+    return masked;
+}
+
+void IntEnable(uint32_t ui32Interrupt)
+{
+    if(ui32Interrupt >= NUM_INTERRUPTS) { hostFail("interrupt %u does not exist", ui32Interrupt); }
+    host_Enabled[ui32Interrupt] = true;
+}
+
+void IntDisable(uint32_t ui32Interrupt)
+{
+    if(ui32Interrupt < NUM_INTERRUPTS) { host_Enabled[ui32Interrupt] = false; }
+}
+
+void IntPendSet(uint32_t ui32Interrupt)
+{
+    if(ui32Interrupt >= NUM_INTERRUPTS) { hostFail("interrupt %u does not exist", ui32Interrupt); }
+    host_Pending[ui32Interrupt] = true;
+    hostDispatch();
+}
+
+/* *****************************************************************
+ *                        TI-RTOS and board
+ * *****************************************************************
+ */
+
+void Error_init(Error_Block* eb)
+{
+    if(eb != NULL) { eb->code = 0; }
+}
+
+int Error_check(Error_Block* eb)
+{
+    return (eb != NULL) && (eb->code != 0);
+}
+
+void System_flush(void) { fflush(stdout); }
+
+void System_abort(const char* message) { hostFail("%s", message); }
+
+// The test runs the task afterwards with hostRunMilliseconds()
+void BIOS_start(void)
+{
+    host_Started = true;
+    IntMasterEnable();
+}
+
+void Hwi_Params_init(Hwi_Params* params)
+{
+    params->arg         = 0;
+    params->priority    = -1;
+    params->enableInt   = true;
+    params->maskSetting = Hwi_MaskingOption_SELF;
+}
+
+Hwi_Handle Hwi_create(Int intNum, Hwi_FuncPtr hwiFxn, const Hwi_Params* params, Error_Block* eb)
+{
+    (void)eb;
+    if(intNum < 0 || intNum >= NUM_INTERRUPTS) { hostFail("Hwi of interrupt %d", intNum); }
+    host_Hwis[intNum].fxn = hwiFxn;
+    host_Hwis[intNum].arg = (params != NULL) ? params->arg : 0;
+    if(params == NULL || params->enableInt) { host_Enabled[intNum] = true; }
+    return &host_Hwis[intNum];
+}
+
+void Swi_Params_init(Swi_Params* params)
+{
+    params->arg0     = 0;
+    params->arg1     = 0;
+    params->priority = 1;
+}
+
+Swi_Handle Swi_create(Swi_FuncPtr swiFxn, const Swi_Params* params, Error_Block* eb)
+{
+    struct HostSwi* swi;
+
+    (void)eb;
+    if(host_Swi_Count >= HOST_SWI_MAX) { hostFail("too many Swis"); }
+    swi         = &host_Swis[host_Swi_Count++];
+    swi->fxn    = swiFxn;
+    swi->arg0   = (params != NULL) ? params->arg0 : 0;
+    swi->arg1   = (params != NULL) ? params->arg1 : 0;
+    swi->posted = false;
+    return swi;
+}
+
+void Swi_post(Swi_Handle handle)
+{
+    if(!handle->posted)
+    {
+        handle->posted = true;
+        handle->order  = host_Swi_Order++;
+    }
+    // From the task it runs now, from a Hwi when the Hwis end
+    hostDispatch();
+}
+
+void Task_Params_init(Task_Params* params)
+{
+    params->arg0      = 0;
+    params->arg1      = 0;
+    params->priority  = 1;
+    params->stack     = NULL;
+    params->stackSize = 0;
+}
+
+void Task_construct(Task_Struct* task, Task_FuncPtr fxn, const Task_Params* params, Error_Block* eb)
+{
+    (void)eb;
+    if(host_Task_Count >= HOST_TASK_MAX) { hostFail("too many tasks"); }
+    task->fxn      = fxn;
+    task->arg0     = params->arg0;
+    task->arg1     = params->arg1;
+    task->priority = params->priority;
+    host_Tasks[host_Task_Count].task    = task;
+    host_Tasks[host_Task_Count].created = false;
+    host_Tasks[host_Task_Count].wake    = 0;
+    host_Task_Count++;
+}
+
+void Task_sleep(UInt32 ticks)
+{
+    HostTask* task = host_Task_Current;
+
+    if(task == NULL) { hostFail("Task_sleep() out of a task"); }
+    task->wake = host_Cycles + (uint64_t)ticks * HOST_CYCLES_PER_MS;
+    swapcontext(&task->context, &host_Test_Context);
+}
+
+// Board_LED0 is D1 on PN1 and Board_LED1 is D2 on PN0, like gpioPinConfigs of EK_TM4C129EXL.c
+void GPIO_write(unsigned int index, unsigned int value)
+{
+    uint8_t pin = (index == Board_LED0) ? GPIO_PIN_1 : GPIO_PIN_0;
+
+    GPIOPinWrite(GPIO_PORTN_BASE, pin, value ? pin : 0);
+}
+
+void Board_initGeneral(void) { }
+
+void Board_initGPIO(void)
+{
+    GPIOPinTypeGPIOOutput(GPIO_PORTN_BASE, GPIO_PIN_0 | GPIO_PIN_1);
+    GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_0 | GPIO_PIN_1, 0);
+}
+void EK_TM4C129EXL_initDMA(void) { }
+
+// End of file
@@ -0,0 +1,216 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostSim.h
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a header file for C language. The purpose is to run
+    the code of the micro in a Linux host against simulated peripherals.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The headers of this folder replace driverlib, TI-RTOS and the board,
+    the C files model the peripherals the project uses: GPIO, I2C with
+    BME280 sensors, SSI with a MAX7219 chain, UART, timers, ADC and uDMA.
+    Time is counted in cycles of the 120 MHz clock and only advances when
+    the simulation runs, the code of the micro takes no time. An interrupt
+    runs as soon as its peripheral raises it, the interrupts have the same
+    priority and do not nest, the Swis run after them and the tasks last.
+    Host/Makefile builds every test with the firmware, see there.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#ifndef HOST_SHIM_HOSTSIM_H_
+#define HOST_SHIM_HOSTSIM_H_
+
+/* *****************************************************************
+ *                        Included files
+ * *****************************************************************
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+/* *****************************************************************
+ *                        Macros
+ * *****************************************************************
+ */
+
+#define HOST_CLOCK_HZ          120000000
+#define HOST_CYCLES_PER_US     (HOST_CLOCK_HZ / 1000000)
+#define HOST_CYCLES_PER_MS     (HOST_CLOCK_HZ / 1000)
+
+// Registers of the BME280 model, same map as the datasheet
+#define HOST_BME280_REGISTERS  256
+
+// MAX7219 of the longest chain of the display
+#define HOST_MAX7219_CHAIN_MAX 8
+
+// Bytes kept from the UART0 line
+#define HOST_UART_CAPTURE      (1 << 20)
+
+// Counts a check and prints it when it fails, the test ends with hostCheckResult()
+#define HOST_CHECK(condition, ...)                                          \
+    do {                                                                    \
+        host_Checks++;                                                      \
+        if(!(condition)) {                                                  \
+            host_Failures++;                                                \
+            printf("%s:%d: check failed: ", __FILE__, __LINE__);            \
+            printf(__VA_ARGS__);                                            \
+            printf("\n");                                                   \
+        }                                                                   \
+    } while(0)
+
+/* *****************************************************************
+ *                        Definitions
+ * *****************************************************************
+ */
+
+// BME280 on one of the I2C buses, the fault knobs can change at any time
+typedef struct HostBme280
+{
+    uint32_t bus;
+    uint8_t  address;
+    uint8_t  chipId;
+    uint8_t  registers[HOST_BME280_REGISTERS];
+    // Temperature and humidity the next conversions report
+    int32_t  temperature;
+    uint32_t adcPressure;
+    uint32_t adcHumidity;
+    // Address phases answered with a NACK, 0 answers all of them
+    uint32_t nacks;
+    // The sensor does not answer at all
+    bool     absent;
+    // SCL pulses until the sensor releases an SDA it holds low
+    uint8_t  sdaHeld;
+    // Internal state of the model
+    uint8_t  pointer;
+    uint8_t  writeIndex;
+    bool     converting;
+    uint64_t conversionEnd;
+    uint64_t startupEnd;
+    uint32_t conversions;
+    uint32_t resets;
+    struct HostBme280* next;
+}HostBme280;
+
+// Registers of one MAX7219 of the chain
+typedef struct
+{
+    uint8_t  digits[8];
+    uint8_t  decodeMode;
+    uint8_t  intensity;
+    uint8_t  scanLimit;
+    uint8_t  shutdown;
+    uint8_t  displayTest;
+    uint32_t writes;
+    uint16_t shift;
+}HostMax7219;
+
+/* *****************************************************************
+ *                       Global variables
+ * *****************************************************************
+ */
+
+// Cycles of the 120 MHz clock since the start of the test
+extern uint64_t host_Cycles;
+
+extern uint32_t host_Checks;
+extern uint32_t host_Failures;
+
+// Commands given to an I2C master that was still busy, the engine must never do it
+extern uint32_t host_I2c_Overlaps;
+// Cycles from a byte in the RX FIFO to its move by the uDMA
+extern uint32_t host_Dma_Latency;
+
+// MAX7219 chain on SSI2 or on the bit-banged pins, position 0 is next to the micro
+extern HostMax7219 host_Max7219[HOST_MAX7219_CHAIN_MAX];
+extern uint8_t     host_Max7219_Length;
+extern uint32_t    host_Max7219_Loads;
+
+// Everything UART0 sent
+extern uint8_t  host_Uart_Capture[HOST_UART_CAPTURE];
+extern uint32_t host_Uart_Length;
+extern uint32_t host_Uart_Baud;
+
+/* *****************************************************************
+ *                       Function prototypes
+ * *****************************************************************
+ */
+
+// main() of PFinalMain.c, renamed by Host/Makefile
+int firmwareMain(void);
+
+// Runs the peripherals, the interrupts and the Swis for the cycles given
+void hostRunCycles(uint64_t cycles);
+
+// Runs the tasks of the firmware if there are any, otherwise only the simulation
+void hostRunMilliseconds(uint32_t milliseconds);
+
+// Runs until the condition is true or the time is over, gives the condition
+bool hostRunUntil(bool (*condition)(void), uint32_t milliseconds);
+
+// Prints the checks of the test and gives the exit code
+int  hostCheckResult(const char* name);
+
+// Holds the characters of UART0 in its FIFO until the line is released
+void hostUartStall(bool stalled);
+
+// Level of an input pin, the buttons of the board are low when pressed
+void hostGpioSetInput(uint32_t port, uint8_t pin, bool level);
+bool hostGpioOutput(uint32_t port, uint8_t pin);
+
+// Puts a BME280 with the calibration of the datasheet example on the bus of the I2C base
+void hostBme280Attach(HostBme280* sensor, uint32_t i2cBase, uint8_t address);
+// Temperature of the next conversions in centi-degrees, without the offset of the firmware
+void hostBme280SetTemperature(HostBme280* sensor, int32_t centi);
+// Raw temperature that the datasheet formula turns into the centi-degrees
+uint32_t hostBme280RawTemperature(const HostBme280* sensor, int32_t centi);
+
+// Empties the chain, every MAX7219 in shutdown like at power on
+void hostMax7219Init(uint8_t length);
+
+// Temperature of the die seen by the ADC0 sensor in centi-degrees
+void hostAdcSetDieTemperature(int32_t centi);
+
+// Items the uDMA channel moved since the start of the test
+uint32_t hostDmaItems(uint32_t channel);
+
+#endif /* HOST_SHIM_HOSTSIM_H_ */
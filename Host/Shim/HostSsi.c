@@ -0,0 +1,199 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostSsi.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to model the SSI2 that drives
+    the MAX7219 chain of the display.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Words of 16 bits leave the 8 words FIFO at the bit rate and go MSB first
+    into the chain. In mode 0 the FSS pulses after every word, that is the
+    LOAD of the MAX7219, in mode 3 it stays low until the FIFO is empty.
+    The uDMA refills the FIFO when the SSI requests it.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostModels.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_ssi.h"
+#include "driverlib/ssi.h"
+
+#define HOST_SSI_FIFO          8
+
+static struct
+{
+    bool     enabled;
+    bool     frameHeld;
+    bool     dmaTx;
+    uint32_t wordBits;
+    uint32_t bitCycles;
+    uint16_t fifo[HOST_SSI_FIFO];
+    uint8_t  head;
+    uint8_t  count;
+    uint16_t shifting;
+    uint64_t shiftEnd;
+    uint32_t raw;
+    uint32_t mask;
+}host_Ssi = { false, false, false, 16, 60, { 0 }, 0, 0, 0, HOST_NEVER, 0, 0 };
+
+static bool hostSsiIdle(void)
+{
+    return host_Ssi.count == 0 && host_Ssi.shiftEnd == HOST_NEVER;
+}
+
+static uint32_t hostSsiStatus(void)
+{
+    // The end of transmission follows the FIFO, it stays while the SSI is idle
+    return host_Ssi.raw | (hostSsiIdle() ? SSI_TXEOT : 0);
+}
+
+static void hostSsiStart(void)
+{
+    if(host_Ssi.shiftEnd != HOST_NEVER || host_Ssi.count == 0 || !host_Ssi.enabled) { return; }
+
+    host_Ssi.shifting = host_Ssi.fifo[host_Ssi.head];
+    host_Ssi.head     = (uint8_t)((host_Ssi.head + 1) % HOST_SSI_FIFO);
+    host_Ssi.count--;
+    host_Ssi.shiftEnd = host_Cycles + (uint64_t)host_Ssi.wordBits * host_Ssi.bitCycles;
+}
+
+static void hostSsiPush(uint16_t word)
+{
+    host_Ssi.fifo[(host_Ssi.head + host_Ssi.count) % HOST_SSI_FIFO] = word;
+    host_Ssi.count++;
+    hostSsiStart();
+}
+
+// The uDMA keeps the FIFO full while its channel has words
+static void hostSsiRefill(void)
+{
+    HostDmaResult result;
+    uint32_t      word;
+    int           channel;
+
+    if(!host_Ssi.dmaTx) { return; }
+    while(host_Ssi.count < HOST_SSI_FIFO)
+    {
+        channel = hostDmaFind(SSI2_BASE + SSI_O_DR, true);
+        if(channel < 0) { return; }
+        result = hostDmaRead(channel, &word);
+        if(result == host_Dma_Refused) { return; }
+        hostSsiPush((uint16_t)word);
+        if(result == host_Dma_Done) { host_Ssi.raw |= SSI_DMATX; }
+    }
+}
+
+uint64_t hostSsiNext(void)
+{
+    if(host_Ssi.dmaTx && host_Ssi.count < HOST_SSI_FIFO && hostDmaFind(SSI2_BASE + SSI_O_DR, true) >= 0)
+    {
+        return host_Cycles;
+    }
+    return host_Ssi.shiftEnd;
+}
+
+void hostSsiService(void)
+{
+    int8_t bit;
+
+    if(host_Ssi.shiftEnd <= host_Cycles)
+    {
+        for(bit = (int8_t)(host_Ssi.wordBits - 1); bit >= 0; bit--)
+        {
+            hostMax7219Shift(((host_Ssi.shifting >> bit) & 1) != 0);
+        }
+        host_Ssi.shiftEnd = HOST_NEVER;
+        // Mode 0 raises the FSS after the word, mode 3 when nothing is left
+        if(!host_Ssi.frameHeld || host_Ssi.count == 0) { hostMax7219Load(); }
+        hostSsiStart();
+    }
+    hostSsiRefill();
+}
+
+bool hostSsiAsserted(uint32_t interrupt)
+{
+    return interrupt == INT_SSI2 && (hostSsiStatus() & host_Ssi.mask) != 0;
+}
+
+void SSIConfigSetExpClk(uint32_t ui32Base, uint32_t ui32SSIClk, uint32_t ui32Protocol, uint32_t ui32Mode,
+                        uint32_t ui32BitRate, uint32_t ui32DataWidth)
+{
+    if(ui32Base != SSI2_BASE) { hostFail("SSI 0x%08x is not modelled", ui32Base); }
+    host_Ssi.frameHeld = ui32Protocol == SSI_FRF_MOTO_MODE_3;
+    host_Ssi.bitCycles = ui32SSIClk / ui32BitRate;
+    host_Ssi.wordBits  = ui32DataWidth;
+}
+
+void SSIEnable(uint32_t ui32Base)                        { host_Ssi.enabled = true; hostSsiStart(); }
+void SSIDMAEnable(uint32_t ui32Base, uint32_t ui32Flags) { host_Ssi.dmaTx = (ui32Flags & SSI_DMA_TX) != 0; }
+void SSIIntEnable(uint32_t ui32Base, uint32_t ui32Flags) { host_Ssi.mask |= ui32Flags; }
+void SSIIntDisable(uint32_t ui32Base, uint32_t ui32Flags){ host_Ssi.mask &= ~ui32Flags; }
+void SSIIntClear(uint32_t ui32Base, uint32_t ui32Flags)  { host_Ssi.raw &= ~ui32Flags; }
+
+uint32_t SSIIntStatus(uint32_t ui32Base, bool bMasked)
+{
+    return bMasked ? (hostSsiStatus() & host_Ssi.mask) : hostSsiStatus();
+}
+
+void SSIDataPut(uint32_t ui32Base, uint32_t ui32Data)
+{
+    // Blocks like the driverlib until the FIFO has room
+    while(host_Ssi.count >= HOST_SSI_FIFO)
+    {
+        if(host_Ssi.shiftEnd == HOST_NEVER) { hostFail("SSI2 FIFO full and not enabled"); }
+        hostRunCycles(host_Ssi.shiftEnd - host_Cycles);
+    }
+    hostSsiPush((uint16_t)ui32Data);
+}
+
+bool SSIBusy(uint32_t ui32Base)
+{
+    bool busy = !hostSsiIdle();
+
+    // Every poll lets the word in the shift register go on
+    if(busy && host_Ssi.shiftEnd != HOST_NEVER) { hostRunCycles(host_Ssi.shiftEnd - host_Cycles); }
+    return busy;
+}
+
+// End of file
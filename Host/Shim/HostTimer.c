@@ -0,0 +1,188 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostTimer.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to model the timers 1 to 4 of
+    the project.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Only the timer A in 32 bits, periodic or one shot. It counts down from
+    the load value and its timeout comes load + 1 cycles after the start,
+    TIMER4 also starts the conversions of the ADC0.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostModels.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "driverlib/timer.h"
+
+typedef struct
+{
+    uint32_t base;
+    uint32_t interrupt;
+    bool     periodic;
+    bool     enabled;
+    bool     adcTrigger;
+    uint32_t load;
+    uint64_t timeout;
+    uint32_t raw;
+    uint32_t mask;
+}HostTimer;
+
+static HostTimer host_Timers[] =
+{
+    { TIMER1_BASE, INT_TIMER1A },
+    { TIMER2_BASE, INT_TIMER2A },
+    { TIMER3_BASE, INT_TIMER3A },
+    { TIMER4_BASE, INT_TIMER4A },
+};
+
+#define HOST_TIMERS            (sizeof(host_Timers) / sizeof(host_Timers[0]))
+
+static HostTimer* hostTimer(uint32_t base)
+{
+    size_t index;
+
+    for(index = 0; index < HOST_TIMERS; index++)
+    {
+        if(host_Timers[index].base == base) { return &host_Timers[index]; }
+    }
+    hostFail("timer 0x%08x is not modelled", base);
+    return NULL;
+}
+
+static void hostTimerStart(HostTimer* timer)
+{
+    timer->timeout = host_Cycles + (uint64_t)timer->load + 1;
+}
+
+uint64_t hostTimerNext(void)
+{
+    uint64_t next = HOST_NEVER;
+    size_t   index;
+
+    for(index = 0; index < HOST_TIMERS; index++)
+    {
+        if(host_Timers[index].enabled && host_Timers[index].timeout < next) { next = host_Timers[index].timeout; }
+    }
+    return next;
+}
+
+void hostTimerService(void)
+{
+    HostTimer* timer;
+    size_t     index;
+
+    for(index = 0; index < HOST_TIMERS; index++)
+    {
+        timer = &host_Timers[index];
+        if(!timer->enabled || timer->timeout > host_Cycles) { continue; }
+
+        timer->raw |= TIMER_TIMA_TIMEOUT;
+        if(timer->periodic)
+        {
+            timer->timeout += (uint64_t)timer->load + 1;
+        }
+        else
+        {
+            timer->enabled = false;
+        }
+        if(timer->adcTrigger) { hostAdcTrigger(); }
+    }
+}
+
+bool hostTimerAsserted(uint32_t interrupt)
+{
+    size_t index;
+
+    for(index = 0; index < HOST_TIMERS; index++)
+    {
+        if(host_Timers[index].interrupt == interrupt) { return (host_Timers[index].raw & host_Timers[index].mask) != 0; }
+    }
+    return false;
+}
+
+void TimerConfigure(uint32_t ui32Base, uint32_t ui32Config)
+{
+    HostTimer* timer = hostTimer(ui32Base);
+
+    timer->enabled  = false;
+    timer->periodic = ui32Config == TIMER_CFG_PERIODIC;
+}
+
+void TimerControlTrigger(uint32_t ui32Base, uint32_t ui32Timer, bool bEnable) { hostTimer(ui32Base)->adcTrigger = bEnable; }
+void TimerADCEventSet(uint32_t ui32Base, uint32_t ui32ADCEvent)               { (void)hostTimer(ui32Base); }
+void TimerIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)                 { hostTimer(ui32Base)->mask |= ui32IntFlags; }
+void TimerIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)                  { hostTimer(ui32Base)->raw &= ~ui32IntFlags; }
+void TimerDisable(uint32_t ui32Base, uint32_t ui32Timer)                      { hostTimer(ui32Base)->enabled = false; }
+
+// A running timer takes the new value at its next timeout
+void TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value)
+{
+    hostTimer(ui32Base)->load = ui32Value;
+}
+
+uint32_t TimerLoadGet(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    return hostTimer(ui32Base)->load;
+}
+
+uint32_t TimerValueGet(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    HostTimer* timer = hostTimer(ui32Base);
+
+    if(!timer->enabled) { return timer->load; }
+    return (uint32_t)(timer->timeout - host_Cycles - 1);
+}
+
+void TimerEnable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    HostTimer* timer = hostTimer(ui32Base);
+
+    if(timer->enabled) { return; }
+    timer->enabled = true;
+    hostTimerStart(timer);
+}
+
+// End of file
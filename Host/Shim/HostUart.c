@@ -0,0 +1,166 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    HostUart.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to model the TX side of the
+    UART0 that sends the telemetry.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Characters of 10 bits leave the 16 characters FIFO at the baud rate
+    and are kept in host_Uart_Capture. The TX interrupt comes when the FIFO
+    goes down to 8 characters, the level of UART_FIFO_TX4_8. A stalled line
+    holds the next character, like a host that stops reading.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostModels.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "driverlib/uart.h"
+
+#define HOST_UART_FIFO         16
+#define HOST_UART_TX_LEVEL     8
+// Start, 8 data bits and stop
+#define HOST_UART_FRAME_BITS   10
+
+uint8_t  host_Uart_Capture[HOST_UART_CAPTURE];
+uint32_t host_Uart_Length = 0;
+uint32_t host_Uart_Baud   = 0;
+
+static struct
+{
+    uint32_t charCycles;
+    uint8_t  fifo[HOST_UART_FIFO];
+    uint8_t  head;
+    uint8_t  count;
+    uint64_t charEnd;
+    uint32_t raw;
+    uint32_t mask;
+    bool     stalled;
+}host_Uart = { 10417, { 0 }, 0, 0, HOST_NEVER, 0, 0, false };
+
+static void hostUartStart(void)
+{
+    if(host_Uart.charEnd == HOST_NEVER && host_Uart.count != 0 && !host_Uart.stalled)
+    {
+        host_Uart.charEnd = host_Cycles + host_Uart.charCycles;
+    }
+}
+
+uint64_t hostUartNext(void)
+{
+    return host_Uart.charEnd;
+}
+
+void hostUartService(void)
+{
+    if(host_Uart.charEnd > host_Cycles) { return; }
+
+    if(host_Uart_Length < HOST_UART_CAPTURE) { host_Uart_Capture[host_Uart_Length++] = host_Uart.fifo[host_Uart.head]; }
+    host_Uart.head = (uint8_t)((host_Uart.head + 1) % HOST_UART_FIFO);
+    host_Uart.count--;
+    if(host_Uart.count == HOST_UART_TX_LEVEL) { host_Uart.raw |= UART_INT_TX; }
+    host_Uart.charEnd = HOST_NEVER;
+    hostUartStart();
+}
+
+void hostUartStall(bool stalled)
+{
+    host_Uart.stalled = stalled;
+    hostUartStart();
+}
+
+bool hostUartAsserted(uint32_t interrupt)
+{
+    return interrupt == INT_UART0 && (host_Uart.raw & host_Uart.mask) != 0;
+}
+
+void UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk, uint32_t ui32Baud, uint32_t ui32Config)
+{
+    if(ui32Base != UART0_BASE) { hostFail("UART 0x%08x is not modelled", ui32Base); }
+    if(ui32Baud == 0 || ui32Baud > ui32UARTClk / 8) { hostFail("UART0 at %u baud", ui32Baud); }
+    host_Uart_Baud       = ui32Baud;
+    host_Uart.charCycles = (uint32_t)(((uint64_t)ui32UARTClk * HOST_UART_FRAME_BITS) / ui32Baud);
+}
+
+void UARTFIFOEnable(uint32_t ui32Base)                                          { (void)ui32Base; }
+void UARTFIFOLevelSet(uint32_t ui32Base, uint32_t ui32TxLevel, uint32_t ui32RxLevel) { (void)ui32Base; }
+void UARTTxIntModeSet(uint32_t ui32Base, uint32_t ui32Mode)                     { (void)ui32Base; }
+void UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)                    { host_Uart.mask |= ui32IntFlags; }
+void UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)                     { host_Uart.raw &= ~ui32IntFlags; }
+
+uint32_t UARTIntStatus(uint32_t ui32Base, bool bMasked)
+{
+    return bMasked ? (host_Uart.raw & host_Uart.mask) : host_Uart.raw;
+}
+
+bool UARTSpaceAvail(uint32_t ui32Base)
+{
+    return host_Uart.count < HOST_UART_FIFO;
+}
+
+bool UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData)
+{
+    if(host_Uart.count >= HOST_UART_FIFO) { return false; }
+    host_Uart.fifo[(host_Uart.head + host_Uart.count) % HOST_UART_FIFO] = ucData;
+    host_Uart.count++;
+    hostUartStart();
+    return true;
+}
+
+// Waits for room in the FIFO like the driverlib loop on the flag register
+void UARTCharPut(uint32_t ui32Base, unsigned char ucData)
+{
+    while(!UARTCharPutNonBlocking(ui32Base, ucData)) { hostRunCycles(host_Uart.charEnd - host_Cycles); }
+}
+
+bool UARTBusy(uint32_t ui32Base)
+{
+    bool busy = host_Uart.charEnd != HOST_NEVER;
+
+    // Every poll lets the character in the shift register go out
+    if(busy) { hostRunCycles(host_Uart.charEnd - host_Cycles); }
+    return busy;
+}
+
+// End of file
@@ -0,0 +1,52 @@
+/* Host stand-in of driverlib/adc.h, the ADC0 is modelled by HostAdc.c */
+
+#ifndef HOST_DRIVERLIB_ADC_H_
+#define HOST_DRIVERLIB_ADC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ADC_TRIGGER_PROCESSOR    0x00000000
+#define ADC_TRIGGER_TIMER        0x00000005
+
+#define ADC_CTL_TS               0x00000080
+#define ADC_CTL_IE               0x00000040
+#define ADC_CTL_END              0x00000020
+#define ADC_CTL_CMP0             0x00080000
+#define ADC_CTL_CMP1             0x00090000
+#define ADC_CTL_CMP2             0x000A0000
+#define ADC_CTL_CMP3             0x000B0000
+
+#define ADC_INT_DMA_SS0          0x00000100
+#define ADC_INT_DMA_SS1          0x00000200
+
+// Interrupt enable, band (CIC) and mode (CIM) of ADCDCCTL
+#define ADC_COMP_INT_LOW_ALWAYS  0x00000010
+#define ADC_COMP_INT_LOW_ONCE    0x00000011
+#define ADC_COMP_INT_LOW_HALWAYS 0x00000012
+#define ADC_COMP_INT_LOW_HONCE   0x00000013
+#define ADC_COMP_INT_HIGH_ALWAYS 0x0000001C
+#define ADC_COMP_INT_HIGH_ONCE   0x0000001D
+#define ADC_COMP_INT_HIGH_HALWAYS 0x0000001E
+#define ADC_COMP_INT_HIGH_HONCE  0x0000001F
+
+void     ADCSequenceConfigure(uint32_t ui32Base, uint32_t ui32SequenceNum, uint32_t ui32Trigger, uint32_t ui32Priority);
+void     ADCSequenceStepConfigure(uint32_t ui32Base, uint32_t ui32SequenceNum, uint32_t ui32Step, uint32_t ui32Config);
+void     ADCSequenceEnable(uint32_t ui32Base, uint32_t ui32SequenceNum);
+void     ADCSequenceDisable(uint32_t ui32Base, uint32_t ui32SequenceNum);
+void     ADCSequenceDMAEnable(uint32_t ui32Base, uint32_t ui32SequenceNum);
+void     ADCProcessorTrigger(uint32_t ui32Base, uint32_t ui32SequenceNum);
+uint32_t ADCIntStatus(uint32_t ui32Base, uint32_t ui32SequenceNum, bool bMasked);
+void     ADCIntClear(uint32_t ui32Base, uint32_t ui32SequenceNum);
+int32_t  ADCSequenceDataGet(uint32_t ui32Base, uint32_t ui32SequenceNum, uint32_t* pui32Buffer);
+void     ADCHardwareOversampleConfigure(uint32_t ui32Base, uint32_t ui32Factor);
+void     ADCIntEnableEx(uint32_t ui32Base, uint32_t ui32IntFlags);
+void     ADCIntClearEx(uint32_t ui32Base, uint32_t ui32IntFlags);
+void     ADCComparatorConfigure(uint32_t ui32Base, uint32_t ui32Comp, uint32_t ui32Config);
+void     ADCComparatorRegionSet(uint32_t ui32Base, uint32_t ui32Comp, uint32_t ui32LowRef, uint32_t ui32HighRef);
+void     ADCComparatorReset(uint32_t ui32Base, uint32_t ui32Comp, bool bTrigger, bool bInterrupt);
+void     ADCComparatorIntEnable(uint32_t ui32Base, uint32_t ui32SequenceNum);
+uint32_t ADCComparatorIntStatus(uint32_t ui32Base);
+void     ADCComparatorIntClear(uint32_t ui32Base, uint32_t ui32Status);
+
+#endif /* HOST_DRIVERLIB_ADC_H_ */
@@ -0,0 +1,46 @@
+/* Host stand-in of driverlib/gpio.h, the pins are modelled by HostGpio.c */
+
+#ifndef HOST_DRIVERLIB_GPIO_H_
+#define HOST_DRIVERLIB_GPIO_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GPIO_PIN_0             0x00000001
+#define GPIO_PIN_1             0x00000002
+#define GPIO_PIN_2             0x00000004
+#define GPIO_PIN_3             0x00000008
+#define GPIO_PIN_4             0x00000010
+#define GPIO_PIN_5             0x00000020
+#define GPIO_PIN_6             0x00000040
+#define GPIO_PIN_7             0x00000080
+
+#define GPIO_DIR_MODE_IN       0x00000000
+#define GPIO_DIR_MODE_OUT      0x00000001
+#define GPIO_DIR_MODE_HW       0x00000002
+
+#define GPIO_STRENGTH_2MA      0x00000001
+#define GPIO_PIN_TYPE_STD      0x00000008
+#define GPIO_PIN_TYPE_STD_WPU  0x0000000A
+
+#define GPIO_INT_PIN_0         0x00000001
+#define GPIO_INT_PIN_1         0x00000002
+#define GPIO_RISING_EDGE       0x00000004
+#define GPIO_DISCRETE_INT      0x00010000
+
+void    GPIODirModeSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32PinIO);
+void    GPIOPadConfigSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32Strength, uint32_t ui32PadType);
+void    GPIOIntTypeSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32IntType);
+void    GPIOIntEnable(uint32_t ui32Port, uint32_t ui32IntFlags);
+int32_t GPIOPinRead(uint32_t ui32Port, uint8_t ui8Pins);
+void    GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val);
+void    GPIOPinConfigure(uint32_t ui32PinConfig);
+void    GPIOPinTypeGPIOInput(uint32_t ui32Port, uint8_t ui8Pins);
+void    GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins);
+void    GPIOPinTypeGPIOOutputOD(uint32_t ui32Port, uint8_t ui8Pins);
+void    GPIOPinTypeI2C(uint32_t ui32Port, uint8_t ui8Pins);
+void    GPIOPinTypeI2CSCL(uint32_t ui32Port, uint8_t ui8Pins);
+void    GPIOPinTypeSSI(uint32_t ui32Port, uint8_t ui8Pins);
+void    GPIOPinTypeUART(uint32_t ui32Port, uint8_t ui8Pins);
+
+#endif /* HOST_DRIVERLIB_GPIO_H_ */
@@ -0,0 +1,55 @@
+/* Host stand-in of driverlib/i2c.h, the masters are modelled by HostI2c.c */
+
+#ifndef HOST_DRIVERLIB_I2C_H_
+#define HOST_DRIVERLIB_I2C_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Bits of I2CMCS, a command is a combination of them
+#define I2C_MASTER_CMD_SINGLE_SEND            0x00000007
+#define I2C_MASTER_CMD_BURST_SEND_START       0x00000003
+#define I2C_MASTER_CMD_BURST_SEND_CONT        0x00000001
+#define I2C_MASTER_CMD_BURST_SEND_FINISH      0x00000005
+#define I2C_MASTER_CMD_BURST_SEND_ERROR_STOP  0x00000004
+#define I2C_MASTER_CMD_SINGLE_RECEIVE         0x00000007
+#define I2C_MASTER_CMD_BURST_RECEIVE_START    0x0000000b
+#define I2C_MASTER_CMD_BURST_RECEIVE_CONT     0x00000009
+#define I2C_MASTER_CMD_BURST_RECEIVE_FINISH   0x00000005
+#define I2C_MASTER_CMD_FIFO_SINGLE_RECEIVE    0x00000046
+
+// Raw and masked interrupt status of I2CMRIS/I2CMMIS
+#define I2C_MASTER_INT_RX_FIFO_FULL   0x00000800
+#define I2C_MASTER_INT_TX_FIFO_EMPTY  0x00000400
+#define I2C_MASTER_INT_RX_FIFO_REQ    0x00000200
+#define I2C_MASTER_INT_TX_FIFO_REQ    0x00000100
+#define I2C_MASTER_INT_ARB_LOST       0x00000080
+#define I2C_MASTER_INT_STOP           0x00000040
+#define I2C_MASTER_INT_START          0x00000020
+#define I2C_MASTER_INT_NACK           0x00000010
+#define I2C_MASTER_INT_TX_DMA_DONE    0x00000008
+#define I2C_MASTER_INT_RX_DMA_DONE    0x00000004
+#define I2C_MASTER_INT_TIMEOUT        0x00000002
+#define I2C_MASTER_INT_DATA           0x00000001
+
+#define I2C_FIFO_CFG_RX_MASTER        0x80000000
+#define I2C_FIFO_CFG_RX_MASTER_DMA    0xA0000000
+#define I2C_FIFO_CFG_RX_TRIG_4        0x00040000
+
+void     I2CMasterInitExpClk(uint32_t ui32Base, uint32_t ui32I2CClk, bool bFast);
+void     I2CMasterTimeoutSet(uint32_t ui32Base, uint32_t ui32Value);
+bool     I2CMasterBusBusy(uint32_t ui32Base);
+void     I2CMasterControl(uint32_t ui32Base, uint32_t ui32Cmd);
+void     I2CMasterDataPut(uint32_t ui32Base, uint8_t ui8Data);
+uint32_t I2CMasterDataGet(uint32_t ui32Base);
+void     I2CMasterSlaveAddrSet(uint32_t ui32Base, uint8_t ui8SlaveAddr, bool bReceive);
+void     I2CMasterBurstLengthSet(uint32_t ui32Base, uint8_t ui8Length);
+void     I2CMasterIntEnableEx(uint32_t ui32Base, uint32_t ui32IntFlags);
+void     I2CMasterIntDisableEx(uint32_t ui32Base, uint32_t ui32IntFlags);
+void     I2CMasterIntClearEx(uint32_t ui32Base, uint32_t ui32IntFlags);
+uint32_t I2CMasterIntStatusEx(uint32_t ui32Base, bool bMasked);
+void     I2CRxFIFOConfigSet(uint32_t ui32Base, uint32_t ui32Config);
+void     I2CRxFIFOFlush(uint32_t ui32Base);
+uint32_t I2CFIFODataGetNonBlocking(uint32_t ui32Base, uint8_t* pui8Data);
+
+#endif /* HOST_DRIVERLIB_I2C_H_ */
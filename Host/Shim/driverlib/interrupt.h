@@ -0,0 +1,16 @@
+/* Host stand-in of driverlib/interrupt.h */
+
+#ifndef HOST_DRIVERLIB_INTERRUPT_H_
+#define HOST_DRIVERLIB_INTERRUPT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Both return true when the interrupts were already disabled
+bool IntMasterEnable(void);
+bool IntMasterDisable(void);
+void IntEnable(uint32_t ui32Interrupt);
+void IntDisable(uint32_t ui32Interrupt);
+void IntPendSet(uint32_t ui32Interrupt);
+
+#endif /* HOST_DRIVERLIB_INTERRUPT_H_ */
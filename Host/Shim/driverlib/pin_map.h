@@ -0,0 +1,18 @@
+/* Host stand-in of driverlib/pin_map.h, GPIOPinConfigure() ignores the values */
+
+#ifndef HOST_DRIVERLIB_PIN_MAP_H_
+#define HOST_DRIVERLIB_PIN_MAP_H_
+
+#define GPIO_PA0_U0RX       0x00000001
+#define GPIO_PA1_U0TX       0x00000401
+#define GPIO_PA2_I2C8SCL    0x00000802
+#define GPIO_PA3_I2C8SDA    0x00000C02
+#define GPIO_PD0_I2C7SCL    0x00030002
+#define GPIO_PD1_I2C7SDA    0x00030402
+#define GPIO_PD1_SSI2XDAT0  0x0003040F
+#define GPIO_PD2_SSI2FSS    0x0003080F
+#define GPIO_PD3_SSI2CLK    0x00030C0F
+#define GPIO_PN4_I2C2SDA    0x000C1003
+#define GPIO_PN5_I2C2SCL    0x000C1403
+
+#endif /* HOST_DRIVERLIB_PIN_MAP_H_ */
@@ -0,0 +1,29 @@
+/* Host stand-in of driverlib/ssi.h, the SSI is modelled by HostSsi.c */
+
+#ifndef HOST_DRIVERLIB_SSI_H_
+#define HOST_DRIVERLIB_SSI_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SSI_FRF_MOTO_MODE_0  0x00000000
+#define SSI_FRF_MOTO_MODE_3  0x000000C0
+#define SSI_MODE_MASTER      0x00000000
+
+#define SSI_TXEOT            0x00000040
+#define SSI_DMATX            0x00000020
+#define SSI_DMA_TX           0x00000002
+
+void     SSIConfigSetExpClk(uint32_t ui32Base, uint32_t ui32SSIClk, uint32_t ui32Protocol, uint32_t ui32Mode,
+                            uint32_t ui32BitRate, uint32_t ui32DataWidth);
+void     SSIEnable(uint32_t ui32Base);
+void     SSIDMAEnable(uint32_t ui32Base, uint32_t ui32DMAFlags);
+// Waits for room in the FIFO, the simulated time advances
+void     SSIDataPut(uint32_t ui32Base, uint32_t ui32Data);
+bool     SSIBusy(uint32_t ui32Base);
+void     SSIIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+void     SSIIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags);
+void     SSIIntClear(uint32_t ui32Base, uint32_t ui32IntFlags);
+uint32_t SSIIntStatus(uint32_t ui32Base, bool bMasked);
+
+#endif /* HOST_DRIVERLIB_SSI_H_ */
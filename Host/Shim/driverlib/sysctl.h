@@ -0,0 +1,31 @@
+/* Host stand-in of driverlib/sysctl.h, only what the project uses */
+
+#ifndef HOST_DRIVERLIB_SYSCTL_H_
+#define HOST_DRIVERLIB_SYSCTL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SYSCTL_PERIPH_ADC0   0xF0003800
+#define SYSCTL_PERIPH_GPIOA  0xF0000800
+#define SYSCTL_PERIPH_GPIOD  0xF0000803
+#define SYSCTL_PERIPH_GPIOJ  0xF0000808
+#define SYSCTL_PERIPH_GPION  0xF000080C
+#define SYSCTL_PERIPH_I2C2   0xF0002002
+#define SYSCTL_PERIPH_I2C7   0xF0002007
+#define SYSCTL_PERIPH_I2C8   0xF0002008
+#define SYSCTL_PERIPH_SSI2   0xF0001C02
+#define SYSCTL_PERIPH_TIMER1 0xF0000401
+#define SYSCTL_PERIPH_TIMER2 0xF0000402
+#define SYSCTL_PERIPH_TIMER3 0xF0000403
+#define SYSCTL_PERIPH_TIMER4 0xF0000404
+#define SYSCTL_PERIPH_UART0  0xF0001800
+
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral);
+void SysCtlPeripheralDisable(uint32_t ui32Peripheral);
+void SysCtlPeripheralReset(uint32_t ui32Peripheral);
+bool SysCtlPeripheralReady(uint32_t ui32Peripheral);
+// Three cycles per count, the simulated time advances by them
+void SysCtlDelay(uint32_t ui32Count);
+
+#endif /* HOST_DRIVERLIB_SYSCTL_H_ */
@@ -0,0 +1,26 @@
+/* Host stand-in of driverlib/timer.h, the timers are modelled by HostTimer.c */
+
+#ifndef HOST_DRIVERLIB_TIMER_H_
+#define HOST_DRIVERLIB_TIMER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TIMER_CFG_ONE_SHOT    0x00000021
+#define TIMER_CFG_PERIODIC    0x00000022
+#define TIMER_A               0x000000FF
+#define TIMER_TIMA_TIMEOUT    0x00000001
+#define TIMER_ADC_TIMEOUT_A   0x00000001
+
+void     TimerConfigure(uint32_t ui32Base, uint32_t ui32Config);
+void     TimerControlTrigger(uint32_t ui32Base, uint32_t ui32Timer, bool bEnable);
+void     TimerADCEventSet(uint32_t ui32Base, uint32_t ui32ADCEvent);
+void     TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value);
+uint32_t TimerLoadGet(uint32_t ui32Base, uint32_t ui32Timer);
+uint32_t TimerValueGet(uint32_t ui32Base, uint32_t ui32Timer);
+void     TimerEnable(uint32_t ui32Base, uint32_t ui32Timer);
+void     TimerDisable(uint32_t ui32Base, uint32_t ui32Timer);
+void     TimerIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+void     TimerIntClear(uint32_t ui32Base, uint32_t ui32IntFlags);
+
+#endif /* HOST_DRIVERLIB_TIMER_H_ */
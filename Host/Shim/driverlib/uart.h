@@ -0,0 +1,30 @@
+/* Host stand-in of driverlib/uart.h, the UART is modelled by HostUart.c */
+
+#ifndef HOST_DRIVERLIB_UART_H_
+#define HOST_DRIVERLIB_UART_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UART_CONFIG_WLEN_8    0x00000060
+#define UART_CONFIG_STOP_ONE  0x00000000
+#define UART_CONFIG_PAR_NONE  0x00000000
+
+#define UART_FIFO_TX4_8       0x00000002
+#define UART_FIFO_RX4_8       0x00000010
+#define UART_TXINT_MODE_FIFO  0x00000000
+#define UART_INT_TX           0x00000020
+
+void     UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk, uint32_t ui32Baud, uint32_t ui32Config);
+void     UARTFIFOEnable(uint32_t ui32Base);
+void     UARTFIFOLevelSet(uint32_t ui32Base, uint32_t ui32TxLevel, uint32_t ui32RxLevel);
+void     UARTTxIntModeSet(uint32_t ui32Base, uint32_t ui32Mode);
+void     UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+void     UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags);
+uint32_t UARTIntStatus(uint32_t ui32Base, bool bMasked);
+bool     UARTSpaceAvail(uint32_t ui32Base);
+bool     UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData);
+void     UARTCharPut(uint32_t ui32Base, unsigned char ucData);
+bool     UARTBusy(uint32_t ui32Base);
+
+#endif /* HOST_DRIVERLIB_UART_H_ */
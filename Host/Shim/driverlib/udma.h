@@ -0,0 +1,44 @@
+/* Host stand-in of driverlib/udma.h, the channels are modelled by HostDma.c */
+
+#ifndef HOST_DRIVERLIB_UDMA_H_
+#define HOST_DRIVERLIB_UDMA_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UDMA_CH13_SSI2TX     0x0000000D
+#define UDMA_CH15_ADC0_1     0x0000000F
+// Free channel for the I2C2 RX FIFO of the host builds, the model matches the
+// channels to the peripherals by the FIFO address, not by the number
+#define HOST_UDMA_CH_I2C2RX  0x0000001E
+
+#define UDMA_PRI_SELECT      0x00000000
+#define UDMA_ALT_SELECT      0x00000020
+
+#define UDMA_MODE_STOP       0x00000000
+#define UDMA_MODE_BASIC      0x00000001
+#define UDMA_MODE_PINGPONG   0x00000003
+
+#define UDMA_ATTR_ALL        0x0000000F
+
+#define UDMA_DST_INC_8       0x00000000
+#define UDMA_DST_INC_16      0x40000000
+#define UDMA_DST_INC_NONE    0xC0000000
+#define UDMA_SRC_INC_8       0x00000000
+#define UDMA_SRC_INC_16      0x04000000
+#define UDMA_SRC_INC_NONE    0x0C000000
+#define UDMA_SIZE_8          0x00000000
+#define UDMA_SIZE_16         0x11000000
+#define UDMA_ARB_4           0x00008000
+
+void     uDMAChannelAssign(uint32_t ui32Mapping);
+void     uDMAChannelAttributeDisable(uint32_t ui32ChannelNum, uint32_t ui32Attr);
+void     uDMAChannelControlSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Control);
+void     uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Mode, void* pvSrcAddr,
+                                void* pvDstAddr, uint32_t ui32TransferSize);
+void     uDMAChannelEnable(uint32_t ui32ChannelNum);
+void     uDMAChannelDisable(uint32_t ui32ChannelNum);
+bool     uDMAChannelIsEnabled(uint32_t ui32ChannelNum);
+uint32_t uDMAChannelModeGet(uint32_t ui32ChannelStructIndex);
+
+#endif /* HOST_DRIVERLIB_UDMA_H_ */
@@ -0,0 +1,12 @@
+/* Host stand-in of inc/hw_adc.h */
+
+#ifndef HOST_INC_HW_ADC_H_
+#define HOST_INC_HW_ADC_H_
+
+// Result FIFO of every sample sequencer
+#define ADC_O_SSFIFO0    0x00000048
+#define ADC_O_SSFIFO1    0x00000068
+#define ADC_O_SSFIFO2    0x00000088
+#define ADC_O_SSFIFO3    0x000000A8
+
+#endif /* HOST_INC_HW_ADC_H_ */
@@ -0,0 +1,9 @@
+/* Host stand-in of inc/hw_i2c.h */
+
+#ifndef HOST_INC_HW_I2C_H_
+#define HOST_INC_HW_I2C_H_
+
+// I2C FIFO Data, the source of the uDMA reads
+#define I2C_O_FIFODATA   0x00000F00
+
+#endif /* HOST_INC_HW_I2C_H_ */
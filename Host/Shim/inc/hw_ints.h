@@ -0,0 +1,20 @@
+/* Host stand-in of inc/hw_ints.h, vector numbers of the TM4C1294 */
+
+#ifndef HOST_INC_HW_INTS_H_
+#define HOST_INC_HW_INTS_H_
+
+#define INT_UART0        21
+#define INT_ADC0SS1      31
+#define INT_ADC0SS2      32
+#define INT_TIMER1A      37
+#define INT_TIMER2A      39
+#define INT_TIMER3A      51
+#define INT_I2C2         84
+#define INT_SSI2         73
+#define INT_TIMER4A      86
+#define INT_I2C7         125
+#define INT_I2C8         126
+
+#define NUM_INTERRUPTS   130
+
+#endif /* HOST_INC_HW_INTS_H_ */
@@ -0,0 +1,22 @@
+/* Host stand-in of inc/hw_memmap.h, same base addresses as the TM4C1294 */
+
+#ifndef HOST_INC_HW_MEMMAP_H_
+#define HOST_INC_HW_MEMMAP_H_
+
+#define GPIO_PORTA_BASE  0x40058000
+#define GPIO_PORTD_BASE  0x4005B000
+#define GPIO_PORTJ_BASE  0x40060000
+#define GPIO_PORTN_BASE  0x40064000
+#define SSI2_BASE        0x4000A000
+#define UART0_BASE       0x4000C000
+#define I2C2_BASE        0x40022000
+#define I2C7_BASE        0x400C3000
+#define I2C8_BASE        0x400B8000
+#define TIMER1_BASE      0x40031000
+#define TIMER2_BASE      0x40032000
+#define TIMER3_BASE      0x40033000
+#define TIMER4_BASE      0x40034000
+#define ADC0_BASE        0x40038000
+#define UDMA_BASE        0x400FF000
+
+#endif /* HOST_INC_HW_MEMMAP_H_ */
@@ -0,0 +1,9 @@
+/* Host stand-in of inc/hw_ssi.h */
+
+#ifndef HOST_INC_HW_SSI_H_
+#define HOST_INC_HW_SSI_H_
+
+// SSI Data, the destination of the uDMA writes
+#define SSI_O_DR         0x00000008
+
+#endif /* HOST_INC_HW_SSI_H_ */
@@ -0,0 +1,13 @@
+/* Host stand-in of inc/hw_types.h, the registers are kept by HostSim.c */
+
+#ifndef HOST_INC_HW_TYPES_H_
+#define HOST_INC_HW_TYPES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+volatile uint32_t* hostRegister(uint32_t address);
+
+#define HWREG(x)  (*hostRegister((uint32_t)(x)))
+
+#endif /* HOST_INC_HW_TYPES_H_ */
@@ -0,0 +1,10 @@
+/* Host stand-in of ti/drivers/GPIO.h */
+
+#ifndef HOST_TI_DRIVERS_GPIO_H_
+#define HOST_TI_DRIVERS_GPIO_H_
+
+#include <stdint.h>
+
+void GPIO_write(unsigned int index, unsigned int value);
+
+#endif /* HOST_TI_DRIVERS_GPIO_H_ */
@@ -0,0 +1,9 @@
+/* Host stand-in of ti/sysbios/BIOS.h */
+
+#ifndef HOST_TI_SYSBIOS_BIOS_H_
+#define HOST_TI_SYSBIOS_BIOS_H_
+
+// Returns at once, the test runs the simulation after the main of the firmware
+void BIOS_start(void);
+
+#endif /* HOST_TI_SYSBIOS_BIOS_H_ */
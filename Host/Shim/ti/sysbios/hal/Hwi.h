@@ -0,0 +1,33 @@
+/* Host stand-in of ti/sysbios/hal/Hwi.h, HostSim.c dispatches the interrupts */
+
+#ifndef HOST_TI_SYSBIOS_HAL_HWI_H_
+#define HOST_TI_SYSBIOS_HAL_HWI_H_
+
+#include <xdc/std.h>
+#include <xdc/runtime/Error.h>
+
+typedef enum
+{
+    Hwi_MaskingOption_NONE ,
+    Hwi_MaskingOption_ALL  ,
+    Hwi_MaskingOption_SELF ,
+    Hwi_MaskingOption_BITMASK,
+    Hwi_MaskingOption_LOWER
+}Hwi_MaskingOption;
+
+typedef void (*Hwi_FuncPtr)(UArg arg);
+
+typedef struct
+{
+    UArg              arg;
+    Int               priority;
+    Bool              enableInt;
+    Hwi_MaskingOption maskSetting;
+}Hwi_Params;
+
+typedef struct HostHwi* Hwi_Handle;
+
+void       Hwi_Params_init(Hwi_Params* params);
+Hwi_Handle Hwi_create(Int intNum, Hwi_FuncPtr hwiFxn, const Hwi_Params* params, Error_Block* eb);
+
+#endif /* HOST_TI_SYSBIOS_HAL_HWI_H_ */
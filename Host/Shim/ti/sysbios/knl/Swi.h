@@ -0,0 +1,24 @@
+/* Host stand-in of ti/sysbios/knl/Swi.h, every Swi has the same priority */
+
+#ifndef HOST_TI_SYSBIOS_KNL_SWI_H_
+#define HOST_TI_SYSBIOS_KNL_SWI_H_
+
+#include <xdc/std.h>
+#include <xdc/runtime/Error.h>
+
+typedef void (*Swi_FuncPtr)(UArg arg0, UArg arg1);
+
+typedef struct
+{
+    UArg arg0;
+    UArg arg1;
+    UInt priority;
+}Swi_Params;
+
+typedef struct HostSwi* Swi_Handle;
+
+void       Swi_Params_init(Swi_Params* params);
+Swi_Handle Swi_create(Swi_FuncPtr swiFxn, const Swi_Params* params, Error_Block* eb);
+void       Swi_post(Swi_Handle handle);
+
+#endif /* HOST_TI_SYSBIOS_KNL_SWI_H_ */
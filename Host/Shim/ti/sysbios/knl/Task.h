@@ -0,0 +1,33 @@
+/* Host stand-in of ti/sysbios/knl/Task.h, the tasks share a 1 ms clock tick */
+
+#ifndef HOST_TI_SYSBIOS_KNL_TASK_H_
+#define HOST_TI_SYSBIOS_KNL_TASK_H_
+
+#include <xdc/std.h>
+#include <xdc/runtime/Error.h>
+
+typedef void (*Task_FuncPtr)(UArg arg0, UArg arg1);
+
+typedef struct
+{
+    UArg  arg0;
+    UArg  arg1;
+    Int   priority;
+    Ptr   stack;
+    size_t stackSize;
+}Task_Params;
+
+typedef struct
+{
+    Task_FuncPtr fxn;
+    UArg         arg0;
+    UArg         arg1;
+    Int          priority;
+}Task_Struct;
+
+void Task_Params_init(Task_Params* params);
+void Task_construct(Task_Struct* task, Task_FuncPtr fxn, const Task_Params* params, Error_Block* eb);
+// Gives the control to HostSim.c, which runs the simulation and the other tasks for the ticks
+void Task_sleep(UInt32 ticks);
+
+#endif /* HOST_TI_SYSBIOS_KNL_TASK_H_ */
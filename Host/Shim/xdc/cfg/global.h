@@ -0,0 +1,6 @@
+/* Host stand-in of xdc/cfg/global.h, PFinalMain.cfg creates no static objects used by the code */
+
+#ifndef HOST_XDC_CFG_GLOBAL_H_
+#define HOST_XDC_CFG_GLOBAL_H_
+
+#endif /* HOST_XDC_CFG_GLOBAL_H_ */
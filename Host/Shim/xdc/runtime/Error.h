@@ -0,0 +1,14 @@
+/* Host stand-in of xdc/runtime/Error.h */
+
+#ifndef HOST_XDC_RUNTIME_ERROR_H_
+#define HOST_XDC_RUNTIME_ERROR_H_
+
+typedef struct
+{
+    int code;
+}Error_Block;
+
+void Error_init(Error_Block* eb);
+int  Error_check(Error_Block* eb);
+
+#endif /* HOST_XDC_RUNTIME_ERROR_H_ */
@@ -0,0 +1,10 @@
+/* Host stand-in of xdc/runtime/Log.h, the logs are dropped */
+
+#ifndef HOST_XDC_RUNTIME_LOG_H_
+#define HOST_XDC_RUNTIME_LOG_H_
+
+#define Log_info0(format)
+#define Log_info1(format, a1)
+#define Log_info2(format, a1, a2)
+
+#endif /* HOST_XDC_RUNTIME_LOG_H_ */
@@ -0,0 +1,9 @@
+/* Host stand-in of xdc/runtime/System.h */
+
+#ifndef HOST_XDC_RUNTIME_SYSTEM_H_
+#define HOST_XDC_RUNTIME_SYSTEM_H_
+
+void System_flush(void);
+void System_abort(const char* message);
+
+#endif /* HOST_XDC_RUNTIME_SYSTEM_H_ */
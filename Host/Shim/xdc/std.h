@@ -0,0 +1,20 @@
+/* Host stand-in of xdc/std.h, the base types of XDCtools */
+
+#ifndef HOST_XDC_STD_H_
+#define HOST_XDC_STD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef void          Void;
+typedef char          Char;
+typedef int           Int;
+typedef unsigned int  UInt;
+typedef uint8_t       UInt8;
+typedef uint32_t      UInt32;
+typedef bool          Bool;
+typedef void*         Ptr;
+typedef uintptr_t     UArg;
+
+#endif /* HOST_XDC_STD_H_ */
@@ -0,0 +1,157 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    TelemetryBench.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to compare the text lines
+    and the binary records of the telemetry in a Linux host.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Builds the same records in both modes with the code of the micro, then
+    measures the bytes per record, the records per second that fit in the
+    UART and the time the host needs to parse them. From Host:
+        make bench
+        ./build/TelemetryBench [baud]
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "TelemetryDecoder.h"
+#include "../../Libraries/Format/Format.h"
+
+#define BENCH_RECORDS       1000000
+#define BENCH_BAUD          115200
+#define BENCH_BITS_PER_BYTE 10
+#define BENCH_TEXT_LENGTH   64
+#define BENCH_READ_LENGTH   4096
+
+static double benchSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+// Same line of sendTemperatureValueUart(), without the status
+static size_t benchTextLine(char* line, const TelemetryRecord* record)
+{
+    size_t length = 0;
+
+    length += formatText(&line[length], "No. ", BENCH_TEXT_LENGTH);
+    length += formatUnsigned(&line[length], record->sequence);
+    length += formatText(&line[length], " Temperatura: ", BENCH_TEXT_LENGTH);
+    length += formatFixed(&line[length], record->value / 10, FORMAT_TENTHS);
+    length += formatText(&line[length], " \xB0" "C\r\n", BENCH_TEXT_LENGTH);
+    return length;
+}
+
+// What a host script does with every line: find the fields and convert them
+static size_t benchParseText(const char* text, size_t length, int64_t* checksum)
+{
+    const char* end = text + length;
+    const char* field;
+    size_t      lines = 0;
+    long        value;
+
+    while(text < end)
+    {
+        field = strstr(text, "No. ");
+        if(field == NULL || field >= end) { break; }
+        value  = strtol(field + 4, (char**)&text, 10);
+        field  = strstr(text, ": ");
+        *checksum += value + (int64_t)(strtod(field + 2, (char**)&text) * 10.0);
+        text   = strchr(text, '\n') + 1;
+        lines++;
+    }
+    return lines;
+}
+
+int main(int argc, char** argv)
+{
+    TelemetryRecord  record, decoded[BENCH_READ_LENGTH];
+    TelemetryDecoder decoder;
+    uint32_t baud = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : BENCH_BAUD;
+    char*    text = malloc((size_t)BENCH_RECORDS * BENCH_TEXT_LENGTH);
+    uint8_t* binary = malloc((size_t)BENCH_RECORDS * TELEMETRY_FRAME_LENGTH);
+    size_t   textLength = 0, binaryLength = 0, lines, records = 0, index, count, record_Index;
+    int64_t  checksum = 0;
+    double   start, textSeconds, binarySeconds;
+
+    if(text == NULL || binary == NULL) { return 1; }
+
+    // Temperatures around 25 C with the noise of the sensor
+    srand(1);
+    for(index = 0; index < BENCH_RECORDS; index++)
+    {
+        record.sequence  = (uint16_t)index;
+        record.timestamp = (uint32_t)index;
+        record.channel   = telemetry_Channel_Temperature;
+        record.value     = 2500 + (rand() % 2001) - 1000;
+        textLength   += benchTextLine(&text[textLength], &record);
+        binaryLength += telemetryEncode(&binary[binaryLength], &record);
+    }
+
+    start       = benchSeconds();
+    lines       = benchParseText(text, textLength, &checksum);
+    textSeconds = benchSeconds() - start;
+
+    telemetryDecoderInit(&decoder);
+    start = benchSeconds();
+    // Blocks of the size a read() of the serial port gives
+    for(index = 0; index < binaryLength; index += BENCH_READ_LENGTH)
+    {
+        count = telemetryDecoderFeed(&decoder, &binary[index], (binaryLength - index < BENCH_READ_LENGTH) ?
+                                     binaryLength - index : BENCH_READ_LENGTH, decoded, BENCH_READ_LENGTH);
+        for(record_Index = 0; record_Index < count; record_Index++) { checksum += decoded[record_Index].value; }
+        records += count;
+    }
+    binarySeconds = benchSeconds() - start;
+
+    printf("mode    bytes/record  records/s @%u  host parse ns/record\n", baud);
+    printf("text    %12.2f  %14.0f  %20.1f\n", (double)textLength / lines,
+           (double)baud / BENCH_BITS_PER_BYTE / ((double)textLength / lines), textSeconds / lines * 1e9);
+    printf("binary  %12.2f  %14.0f  %20.1f\n", (double)binaryLength / records,
+           (double)baud / BENCH_BITS_PER_BYTE / ((double)binaryLength / records), binarySeconds / records * 1e9);
+    printf("crc errors %u, frame errors %u, lost %u, checksum %lld\n", decoder.crcErrors,
+           decoder.frameErrors, decoder.lostFrames, (long long)checksum);
+
+    free(text);
+    free(binary);
+    return (records == BENCH_RECORDS && lines == BENCH_RECORDS) ? 0 : 1;
+}
+
+// End of file
@@ -0,0 +1,238 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    TelemetryDecoder.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to decode the COBS frames
+    of the binary telemetry in a Linux host.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    This source file is going to undo the COBS framing, check the CRC and
+    unpack the records, with defines in header TelemetryDecoder.h.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <string.h>
+#include "TelemetryDecoder.h"
+
+static uint16_t telemetryGet16(const uint8_t* data)
+{
+    return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+static uint32_t telemetryGet32(const uint8_t* data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+// Undoes the COBS of a frame without its delimiter, returns the length or 0 for a bad code
+static uint8_t telemetryCobsDecode(const uint8_t* frame, uint8_t length, uint8_t* raw)
+{
+    uint8_t index = 0;
+    uint8_t size  = 0;
+    uint8_t code;
+    uint8_t copy;
+
+    while(index < length)
+    {
+        code = frame[index++];
+        if(code == 0 || index + code - 1 > length) { return 0; }
+        for(copy = 1; copy < code; copy++)
+        {
+            raw[size++] = frame[index++];
+        }
+        // A code under 0xFF stands for a 0x00, except the last one
+        if(code < 0xFF && index < length)
+        {
+            raw[size++] = 0;
+        }
+    }
+    return size;
+}
+
+// A record has its own length, a stream has the header and a whole number of samples
+static int telemetryValidLength(uint8_t length)
+{
+    if(length == TELEMETRY_RECORD_LENGTH) { return 1; }
+    if(length < TELEMETRY_STREAM_LENGTH(1) || length > TELEMETRY_STREAM_LENGTH(TELEMETRY_STREAM_SAMPLES_MAX)) { return 0; }
+    return ((length - TELEMETRY_STREAM_LENGTH(0)) % TELEMETRY_STREAM_SAMPLE_LENGTH) == 0;
+}
+
+static void telemetryUnpackStream(const uint8_t* raw, TelemetryStream* stream)
+{
+    uint8_t index;
+
+    stream->sequence  = telemetryGet16(&raw[0]);
+    stream->timestamp = telemetryGet32(&raw[2]);
+    stream->sensor    = raw[6];
+    stream->count     = raw[7];
+    stream->dropped   = telemetryGet16(&raw[8]);
+    raw += TELEMETRY_STREAM_HEADER_LENGTH;
+    for(index = 0; index < stream->count; index++)
+    {
+        stream->samples[index].offset      = telemetryGet16(&raw[0]);
+        stream->samples[index].temperature = (int16_t)telemetryGet16(&raw[2]);
+        stream->samples[index].humidity    = telemetryGet16(&raw[4]);
+        stream->samples[index].pressure    = telemetryGet32(&raw[6]);
+        raw += TELEMETRY_STREAM_SAMPLE_LENGTH;
+    }
+}
+
+// Gaps in the sequence, the first frame only sets it
+static void telemetryDecoderSequence(TelemetryDecoder* decoder, uint16_t sequence)
+{
+    if(decoder->synchronized) { decoder->lostFrames += (uint16_t)(sequence - decoder->sequence - 1); }
+    decoder->sequence     = sequence;
+    decoder->synchronized = 1;
+}
+
+void telemetryDecoderInit(TelemetryDecoder* decoder)
+{
+    memset(decoder, 0, sizeof(*decoder));
+}
+
+void telemetryDecoderSetStreamHandler(TelemetryDecoder* decoder, TelemetryStreamHandler handler, void* context)
+{
+    decoder->streamHandler = handler;
+    decoder->context       = context;
+}
+
+// Bytes of the current frame, a frame longer than the biggest stream is marked and dropped
+static void telemetryDecoderAppend(TelemetryDecoder* decoder, const uint8_t* data, size_t length)
+{
+    if(length > sizeof(decoder->frame) - decoder->length)
+    {
+        decoder->overflow = 1;
+        return;
+    }
+    memcpy(&decoder->frame[decoder->length], data, length);
+    decoder->length += (uint8_t)length;
+}
+
+// A delimiter closes the frame, an empty frame is only a resynchronization
+static int telemetryDecoderClose(TelemetryDecoder* decoder, TelemetryRecord* record)
+{
+    uint8_t raw[TELEMETRY_STREAM_FRAME_LENGTH];
+    uint8_t length = 0;
+    int     decoded = TELEMETRY_DECODED_NONE;
+
+    if(decoder->length == 0 && !decoder->overflow)
+    {
+        return TELEMETRY_DECODED_NONE;
+    }
+    if(!decoder->overflow) { length = telemetryCobsDecode(decoder->frame, decoder->length, raw); }
+    decoder->length   = 0;
+    decoder->overflow = 0;
+
+    if(!telemetryValidLength(length))
+    {
+        decoder->frameErrors++;
+    }
+    else if(telemetryCrc16(raw, length - 2) != telemetryGet16(&raw[length - 2]))
+    {
+        decoder->crcErrors++;
+    }
+    else if(length == TELEMETRY_RECORD_LENGTH)
+    {
+        record->sequence  = telemetryGet16(&raw[0]);
+        record->timestamp = telemetryGet32(&raw[2]);
+        record->channel   = raw[6];
+        record->value     = (int32_t)telemetryGet32(&raw[7]);
+        telemetryDecoderSequence(decoder, record->sequence);
+        decoder->records++;
+        decoded = TELEMETRY_DECODED_RECORD;
+    }
+    else
+    {
+        telemetryUnpackStream(raw, &decoder->stream);
+        if(decoder->stream.count != (length - TELEMETRY_STREAM_LENGTH(0)) / TELEMETRY_STREAM_SAMPLE_LENGTH)
+        {
+            decoder->frameErrors++;
+            return TELEMETRY_DECODED_NONE;
+        }
+        telemetryDecoderSequence(decoder, decoder->stream.sequence);
+        decoder->streams++;
+        decoder->samples += decoder->stream.count;
+        decoder->dropped += decoder->stream.dropped;
+        if(decoder->streamHandler != NULL) { decoder->streamHandler(&decoder->stream, decoder->context); }
+        decoded = TELEMETRY_DECODED_STREAM;
+    }
+    return decoded;
+}
+
+int telemetryDecoderPush(TelemetryDecoder* decoder, uint8_t byte, TelemetryRecord* record)
+{
+    if(byte != TELEMETRY_FRAME_DELIMITER)
+    {
+        telemetryDecoderAppend(decoder, &byte, 1);
+        return 0;
+    }
+    return telemetryDecoderClose(decoder, record);
+}
+
+size_t telemetryDecoderFeed(TelemetryDecoder* decoder, const uint8_t* data, size_t length,
+                            TelemetryRecord* records, size_t maxRecords)
+{
+    TelemetryRecord record;
+    const uint8_t*  delimiter;
+    size_t          chunk;
+    size_t          count = 0;
+
+    // The delimiters are found with memchr, the bytes between them are copied at once
+    while(length > 0)
+    {
+        delimiter = memchr(data, TELEMETRY_FRAME_DELIMITER, length);
+        chunk     = (delimiter != NULL) ? (size_t)(delimiter - data) : length;
+        if(chunk > 0) { telemetryDecoderAppend(decoder, data, chunk); }
+        if(delimiter == NULL) { break; }
+
+        if(telemetryDecoderClose(decoder, &record) == TELEMETRY_DECODED_RECORD && count < maxRecords)
+        {
+            records[count++] = record;
+        }
+        data   += chunk + 1;
+        length -= chunk + 1;
+    }
+    return count;
+}
+
+// End of file
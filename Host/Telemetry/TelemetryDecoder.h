@@ -0,0 +1,203 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    TelemetryDecoder.h
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a header file for C language. The purpose is to
+    decode the binary telemetry of the UART in a Linux host.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The decoder takes the bytes as they come from the serial port, one or
+    many at a time, and gives a record for every frame with a valid CRC.
+    The batches of the streaming mode go to a handler of the caller.
+    It is built with gcc next to Libraries/Telemetry/Telemetry.c, see
+    TelemetryBench.c for the command.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#ifndef HOST_TELEMETRY_TELEMETRYDECODER_H_
+#define HOST_TELEMETRY_TELEMETRYDECODER_H_
+
+/* *****************************************************************
+ *                        Included files
+ * *****************************************************************
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include "../../Libraries/Telemetry/Telemetry.h"
+
+/* *****************************************************************
+ *                        Macros
+ * *****************************************************************
+ */
+
+// Results of telemetryDecoderPush()
+#define TELEMETRY_DECODED_NONE      0
+#define TELEMETRY_DECODED_RECORD    1
+#define TELEMETRY_DECODED_STREAM    2
+
+/* *****************************************************************
+ *                       Data types
+ * *****************************************************************
+ */
+
+typedef void (*TelemetryStreamHandler)(const TelemetryStream* stream, void* context);
+
+typedef struct
+{
+    uint8_t  frame[TELEMETRY_STREAM_FRAME_LENGTH];
+    uint8_t  length;
+    uint8_t  overflow;
+    uint8_t  synchronized;
+    uint16_t sequence;
+    uint32_t records;
+    uint32_t streams;
+    uint64_t samples;       // Samples of all the stream frames
+    uint64_t dropped;       // Samples the micro reported as dropped
+    uint32_t crcErrors;     // Frames of the right size with a wrong CRC
+    uint32_t frameErrors;   // Frames of a wrong size or with a bad COBS code
+    uint32_t lostFrames;    // Gaps in the sequence
+    TelemetryStream        stream;     // Last stream frame
+    TelemetryStreamHandler streamHandler;
+    void*                  context;
+}TelemetryDecoder;
+
+/* *****************************************************************
+ *                       Function prototypes
+ * *****************************************************************
+ */
+
+/**
+*****************************************************************************
+*
+*  @brief Clears the decoder and its counters
+*
+*  @param[out]  decoder     Decoder to be initialized
+*
+*  @b example
+*  @code
+*      telemetryDecoderInit(&decoder);
+*  @endcode
+*
+*  @note
+*      A port opened in the middle of a frame gives one frame or CRC error first
+*
+******************************************************************************
+*/
+
+void telemetryDecoderInit(TelemetryDecoder* decoder);
+
+/**
+*****************************************************************************
+*
+*  @brief Gives one byte of the serial port to the decoder
+*
+*  @param[in,out] decoder   Decoder of the port
+*  @param[in]   byte        Byte received
+*  @param[out]  record      Record decoded, only written for TELEMETRY_DECODED_RECORD
+*
+*  @return      TELEMETRY_DECODED_RECORD or TELEMETRY_DECODED_STREAM if the byte closed a
+*               valid frame, TELEMETRY_DECODED_NONE otherwise
+*
+*  @b example
+*  @code
+*      if(telemetryDecoderPush(&decoder, byte, &record) == TELEMETRY_DECODED_RECORD) { ... }
+*  @endcode
+*
+*  @note
+*      A stream frame is left in decoder->stream and given to the handler
+*
+******************************************************************************
+*/
+
+int telemetryDecoderPush(TelemetryDecoder* decoder, uint8_t byte, TelemetryRecord* record);
+
+/**
+*****************************************************************************
+*
+*  @brief Gives a block of the serial port to the decoder
+*
+*  @param[in,out] decoder   Decoder of the port
+*  @param[in]   data        Bytes received
+*  @param[in]   length      Number of bytes
+*  @param[out]  records     Records decoded
+*  @param[in]   maxRecords  Room in records, the frames after it are decoded but not kept
+*
+*  @return      Number of records written
+*
+*  @b example
+*  @code
+*      count = telemetryDecoderFeed(&decoder, buffer, received, records, 64);
+*  @endcode
+*
+*  @note
+*      The stream frames only go to the handler
+*
+******************************************************************************
+*/
+
+size_t telemetryDecoderFeed(TelemetryDecoder* decoder, const uint8_t* data, size_t length,
+                            TelemetryRecord* records, size_t maxRecords);
+
+/**
+*****************************************************************************
+*
+*  @brief Sets the function called for every valid stream frame
+*
+*  @param[in,out] decoder   Decoder of the port
+*  @param[in]   handler     Function of the caller, NULL to only count the samples
+*  @param[in]   context     Given back to the handler
+*
+*  @b example
+*  @code
+*      telemetryDecoderSetStreamHandler(&decoder, storeSamples, &file);
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+
+void telemetryDecoderSetStreamHandler(TelemetryDecoder* decoder, TelemetryStreamHandler handler, void* context);
+
+#endif /* HOST_TELEMETRY_TELEMETRYDECODER_H_ */
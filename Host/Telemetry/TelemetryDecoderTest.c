@@ -0,0 +1,178 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    TelemetryDecoderTest.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to test the decoder of the
+    binary telemetry with the errors of a real serial line.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The records are built with the encoder of the micro and then broken
+    the way a serial line breaks them: a port opened in the middle of a
+    frame, a corrupted byte, a lost delimiter and a gap in the sequence.
+    Every case checks the records decoded and the crcErrors, frameErrors
+    and lostFrames of the decoder. From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostSim.h"
+#include "TelemetryDecoder.h"
+
+#define TEST_FRAMES_MAX        8
+#define TEST_RECORDS_MAX       8
+
+typedef struct
+{
+    uint8_t data[TEST_FRAMES_MAX * TELEMETRY_FRAME_LENGTH];
+    uint8_t start[TEST_FRAMES_MAX];     // Offset of every frame in data
+    size_t  length;
+    uint8_t count;
+}TestLine;
+
+typedef struct
+{
+    size_t   records;
+    uint32_t crcErrors;
+    uint32_t frameErrors;
+    uint32_t lostFrames;
+}TestExpected;
+
+// One record per sequence, the values have zeros so COBS has more than one block
+static void testBuild(TestLine* line, const uint16_t* sequences, uint8_t count)
+{
+    TelemetryRecord record;
+    uint8_t         index;
+
+    line->length = 0;
+    line->count  = count;
+    for(index = 0; index < count; index++)
+    {
+        record.sequence  = sequences[index];
+        record.timestamp = 1000u * sequences[index];
+        record.channel   = index % telemetry_Channel_Count;
+        record.value     = 2437 + index;
+        line->start[index] = (uint8_t)line->length;
+        line->length      += telemetryEncode(&line->data[line->length], &record);
+    }
+}
+
+// First byte of the frame that is data and not a COBS code
+static uint8_t testDataByte(const TestLine* line, uint8_t frame)
+{
+    uint8_t code  = line->start[frame];
+    uint8_t index = code + 1;
+
+    while(index == code + line->data[code])
+    {
+        code  = index;
+        index = code + 1;
+    }
+    return index;
+}
+
+static void testDecode(const char* name, const uint8_t* data, size_t length,
+                       const uint16_t* sequences, const TestExpected* expected)
+{
+    TelemetryDecoder decoder;
+    TelemetryRecord  records[TEST_RECORDS_MAX];
+    size_t           count;
+    size_t           index;
+
+    telemetryDecoderInit(&decoder);
+    count = telemetryDecoderFeed(&decoder, data, length, records, TEST_RECORDS_MAX);
+
+    HOST_CHECK(count == expected->records, "%s: %u records for %u", name, (unsigned)count, (unsigned)expected->records);
+    HOST_CHECK(decoder.crcErrors == expected->crcErrors, "%s: %u CRC errors for %u", name,
+               decoder.crcErrors, expected->crcErrors);
+    HOST_CHECK(decoder.frameErrors == expected->frameErrors, "%s: %u frame errors for %u", name,
+               decoder.frameErrors, expected->frameErrors);
+    HOST_CHECK(decoder.lostFrames == expected->lostFrames, "%s: %u lost frames for %u", name,
+               decoder.lostFrames, expected->lostFrames);
+    for(index = 0; index < count && index < expected->records; index++)
+    {
+        HOST_CHECK(records[index].sequence == sequences[index], "%s: record %u with sequence %u for %u", name,
+                   (unsigned)index, records[index].sequence, sequences[index]);
+    }
+}
+
+int main(void)
+{
+    static const uint16_t sequences[] = { 10, 11, 12, 13 };
+    static const uint16_t corrupted[] = { 10, 12, 13 };
+    static const uint16_t merged[]    = { 10, 13 };
+    static const uint16_t gaps[]      = { 65531, 65532, 65535, 0, 1 };
+    TestLine     line;
+    TestExpected expected;
+    uint8_t      index;
+
+    // All the frames as they left the micro
+    testBuild(&line, sequences, 4);
+    expected = (TestExpected){ 4, 0, 0, 0 };
+    testDecode("clean", line.data, line.length, sequences, &expected);
+
+    // The port opens after the first byte of the first frame, its tail is one bad frame
+    expected = (TestExpected){ 3, 0, 1, 0 };
+    testDecode("middle of a frame", &line.data[1], line.length - 1, &sequences[1], &expected);
+
+    // A data byte of the second frame changes, COBS keeps the length and the CRC finds it
+    index = testDataByte(&line, 1);
+    line.data[index] ^= 0x40;
+    HOST_CHECK(line.data[index] != TELEMETRY_FRAME_DELIMITER, "corrupted byte: the change made a delimiter");
+    expected = (TestExpected){ 3, 1, 0, 1 };
+    testDecode("corrupted byte", line.data, line.length, corrupted, &expected);
+    line.data[index] ^= 0x40;
+
+    // The delimiter of the second frame is lost, the second and the third are one bad frame
+    line.data[line.start[2] - 1] = 0x01;
+    expected = (TestExpected){ 2, 0, 1, 2 };
+    testDecode("lost delimiter", line.data, line.length, merged, &expected);
+
+    // Frames lost without a trace on the line, the sequence also wraps at 16 bits
+    testBuild(&line, gaps, 5);
+    expected = (TestExpected){ 5, 0, 0, 2 };
+    testDecode("sequence gap", line.data, line.length, gaps, &expected);
+
+    return hostCheckResult("TelemetryDecoderTest");
+}
+
+// End of file
@@ -0,0 +1,234 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    TelemetryLoopback.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to measure how many samples
+    per second of the streaming mode a Linux host can receive.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Without a serial port the firmware boots in the streaming mode over the
+    models of Shim/, and everything UART0 sends at UART_SPEED_STREAM goes to
+    the decoder; the seconds are the ones of the model. With a serial port,
+    TX must be wired to RX: a thread sends stream frames built with the
+    code of the micro at the baud given and the main thread decodes them.
+    From Host:
+        make bench
+        ./build/TelemetryLoopback [seconds] [batch] [/dev/ttyUSB0 baud]
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/ioctl.h>
+#include <asm/termbits.h>
+#include "HostSim.h"
+#include "Libraries/Sensor/Sensor.h"
+#include "Libraries/RS232/Rs232.h"
+#include "TelemetryDecoder.h"
+
+#define LOOPBACK_SECONDS        5
+#define LOOPBACK_READ_LENGTH    4096
+#define LOOPBACK_BITS_PER_BYTE  10
+// The model decodes the line every slice, like the reads of a port
+#define LOOPBACK_SLICE_MS       100
+#define LOOPBACK_TEMPERATURE    2437
+
+typedef struct
+{
+    int               fd;
+    uint8_t           batch;
+    volatile int      running;
+    uint64_t          samples;
+    uint64_t          frames;
+}LoopbackWriter;
+
+static double loopbackSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+// Raw 8N1 at any rate, termios2 takes the baud as a number
+static int loopbackOpenPort(const char* device, uint32_t baud)
+{
+    struct termios2 options;
+    int             fd = open(device, O_RDWR | O_NOCTTY);
+
+    if(fd < 0 || ioctl(fd, TCGETS2, &options) < 0) { return -1; }
+    options.c_iflag  = 0;
+    options.c_oflag  = 0;
+    options.c_lflag  = 0;
+    options.c_cflag  = CS8 | CREAD | CLOCAL | BOTHER;
+    options.c_ispeed = baud;
+    options.c_ospeed = baud;
+    options.c_cc[VMIN]  = 0;
+    options.c_cc[VTIME] = 1;
+    if(ioctl(fd, TCSETS2, &options) < 0) { close(fd); return -1; }
+    return fd;
+}
+
+// Same batches of streamSample(), 100 samples per second of a BME280 at 1x oversampling
+static void* loopbackWrite(void* argument)
+{
+    LoopbackWriter* writer = (LoopbackWriter*)argument;
+    TelemetryStream stream;
+    uint8_t         frame[TELEMETRY_STREAM_FRAME_LENGTH];
+    uint8_t         frameLength, index;
+    ssize_t         written, sent;
+
+    memset(&stream, 0, sizeof(stream));
+    stream.count = writer->batch;
+    while(writer->running)
+    {
+        for(index = 0; index < stream.count; index++)
+        {
+            stream.samples[index].offset      = (uint16_t)(index * 1000);
+            stream.samples[index].temperature = (int16_t)(2500 + (rand() % 200) - 100);
+            stream.samples[index].humidity    = (uint16_t)(4500 + (rand() % 100));
+            stream.samples[index].pressure    = 101325u + (uint32_t)(rand() % 50);
+        }
+        frameLength = telemetryEncodeStream(frame, &stream);
+        for(sent = 0; sent < frameLength; sent += written)
+        {
+            written = write(writer->fd, &frame[sent], frameLength - sent);
+            if(written <= 0) { return NULL; }
+        }
+        writer->samples += stream.count;
+        writer->frames++;
+        stream.sequence++;
+        stream.timestamp += 120000u * stream.count;
+    }
+    return NULL;
+}
+
+// Frames of the firmware on the UART0 model, the rate is the one of the sensor and the line
+static void loopbackFirmware(double seconds, uint8_t batch, TelemetryDecoder* decoder, double* elapsed)
+{
+    static HostBme280 sensor;
+    uint32_t          captured = 0;
+    uint32_t          milliseconds;
+
+    hostBme280Attach(&sensor, I2C2_BASE, SLAVE_ADDRESS_EXT);
+    hostBme280SetTemperature(&sensor, LOOPBACK_TEMPERATURE);
+    hostMax7219Init(1);
+    uart_Stream_Batch = batch;
+    firmwareMain();
+
+    for(milliseconds = 0; milliseconds < seconds * 1000 && host_Uart_Length < HOST_UART_CAPTURE; milliseconds += LOOPBACK_SLICE_MS)
+    {
+        hostRunMilliseconds(LOOPBACK_SLICE_MS);
+        telemetryDecoderFeed(decoder, &host_Uart_Capture[captured], host_Uart_Length - captured, NULL, 0);
+        captured = host_Uart_Length;
+    }
+    *elapsed = milliseconds / 1000.0;
+}
+
+// Frames of the writer thread through a port with TX wired to RX
+static int loopbackPort(const char* device, uint32_t baud, double seconds, LoopbackWriter* writer,
+                        TelemetryDecoder* decoder, double* elapsed)
+{
+    pthread_t thread;
+    uint8_t   buffer[LOOPBACK_READ_LENGTH];
+    double    start;
+    ssize_t   received;
+
+    writer->fd = loopbackOpenPort(device, baud);
+    if(writer->fd < 0) { perror(device); return 1; }
+
+    writer->running = 1;
+    start = loopbackSeconds();
+    if(pthread_create(&thread, NULL, loopbackWrite, writer) != 0) { return 1; }
+
+    while((*elapsed = loopbackSeconds() - start) < seconds)
+    {
+        received = read(writer->fd, buffer, sizeof(buffer));
+        if(received < 0) { perror("read"); break; }
+        telemetryDecoderFeed(decoder, buffer, (size_t)received, NULL, 0);
+    }
+    writer->running = 0;
+    pthread_join(thread, NULL);
+    close(writer->fd);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    LoopbackWriter   writer;
+    TelemetryDecoder decoder;
+    double           seconds = (argc > 1) ? atof(argv[1]) : LOOPBACK_SECONDS;
+    uint32_t         baud    = (argc > 4) ? (uint32_t)strtoul(argv[4], NULL, 10) : UART_SPEED_STREAM;
+    double           elapsed = 0;
+    double           frameBytes;
+    uint64_t         sent;
+
+    memset(&writer, 0, sizeof(writer));
+    writer.batch = (argc > 2) ? (uint8_t)atoi(argv[2]) : TELEMETRY_STREAM_SAMPLES_MAX;
+    if(writer.batch == 0 || writer.batch > TELEMETRY_STREAM_SAMPLES_MAX) { writer.batch = TELEMETRY_STREAM_SAMPLES_MAX; }
+    telemetryDecoderInit(&decoder);
+
+    if(argc > 4)
+    {
+        if(loopbackPort(argv[3], baud, seconds, &writer, &decoder, &elapsed) != 0) { return 1; }
+        sent = writer.samples;
+    }
+    else
+    {
+        loopbackFirmware(seconds, writer.batch, &decoder, &elapsed);
+        baud = host_Uart_Baud;
+        sent = sensor_Samples_Total;
+    }
+
+    frameBytes = (double)TELEMETRY_STREAM_LENGTH(writer.batch) + 2;
+    printf("path              %s @ %u baud\n", (argc > 4) ? argv[3] : "firmware on the UART0 model", baud);
+    printf("batch             %u samples, %.0f bytes per frame, %.2f bytes per sample\n",
+           writer.batch, frameBytes, frameBytes / writer.batch);
+    printf("produced          %llu samples in %.1f s\n", (unsigned long long)sent, elapsed);
+    printf("received          %llu samples in %u frames, %.0f samples/s sustained\n", (unsigned long long)decoder.samples,
+           decoder.streams, decoder.samples / elapsed);
+    printf("errors            crc %u, frame %u, lost frames %u, dropped %llu\n", decoder.crcErrors, decoder.frameErrors,
+           decoder.lostFrames, (unsigned long long)decoder.dropped);
+    printf("line limit        %.0f samples/s @ %u, %.0f samples/s @ %u\n",
+           (double)UART_SPEED / LOOPBACK_BITS_PER_BYTE / frameBytes * writer.batch, UART_SPEED,
+           (double)baud / LOOPBACK_BITS_PER_BYTE / frameBytes * writer.batch, baud);
+    return (decoder.crcErrors == 0 && decoder.frameErrors <= 1 && decoder.lostFrames == 0) ? 0 : 1;
+}
+
+// End of file
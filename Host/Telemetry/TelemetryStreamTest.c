@@ -0,0 +1,201 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    TelemetryStreamTest.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to test the streaming mode of
+    the telemetry from the sensor to the decoder of the host.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The firmware boots in the streaming mode and everything UART0 sends at
+    UART_SPEED_STREAM goes to the decoder of the host. The frames must keep
+    their sequence and carry every sample of the sensor. Then the line is
+    stalled so the ring fills up: the dropped field of the frames must add
+    up to uart_Stream_Dropped, also after an outage longer than its 16
+    bits. The samples per second sustained on the line are printed. From Host:
+        make test
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "HostSim.h"
+#include "Libraries/Sensor/Sensor.h"
+#include "Libraries/RS232/Rs232.h"
+#include "TelemetryDecoder.h"
+
+#define TEST_TEMPERATURE_CENTI 2437
+// The raw value of the model is the first one that reaches the temperature
+#define TEST_TOLERANCE_CENTI   2
+#define TEST_RUN_MS            3000
+// Longer than the UART_TX_SLOTS frames of the ring, shorter than the 16 bits of the dropped field
+#define TEST_STALL_MS          3000
+#define TEST_RECOVER_MS        500
+// Start, 8 data bits and stop
+#define TEST_BITS_PER_BYTE     10
+
+typedef struct
+{
+    TelemetryDecoder decoder;
+    uint32_t         captured;      // Bytes of host_Uart_Capture already decoded
+    uint32_t         frames;
+    uint32_t         sequenceErrors;
+    uint32_t         temperatureErrors;
+    uint16_t         sequence;
+    uint16_t         lastDropped;
+    int32_t          temperature;
+}TestStream;
+
+static HostBme280 test_Sensor;
+static TestStream test_Stream;
+
+// Every frame follows the one before and carries the temperature of the model
+static void testStreamFrame(const TelemetryStream* stream, void* context)
+{
+    TestStream* test = (TestStream*)context;
+    uint8_t     index;
+
+    if(test->frames != 0 && stream->sequence != (uint16_t)(test->sequence + 1)) { test->sequenceErrors++; }
+    for(index = 0; index < stream->count; index++)
+    {
+        if(stream->samples[index].temperature < test->temperature - TEST_TOLERANCE_CENTI ||
+           stream->samples[index].temperature > test->temperature + TEST_TOLERANCE_CENTI)
+        {
+            test->temperatureErrors++;
+        }
+    }
+    test->sequence    = stream->sequence;
+    test->lastDropped = stream->dropped;
+    test->frames++;
+}
+
+// Gives the new bytes of the line to the decoder
+static void testStreamDecode(TestStream* test)
+{
+    telemetryDecoderFeed(&test->decoder, &host_Uart_Capture[test->captured], host_Uart_Length - test->captured, NULL, 0);
+    test->captured = host_Uart_Length;
+}
+
+// The batch being filled and the frames still in the ring have not reached the line yet
+static uint32_t testStreamPending(void)
+{
+    return uart_Stream_Batches[0].count + (uart_Tx_Ring.head - uart_Tx_Ring.tail) * uart_Stream_Batch;
+}
+
+// Stops the line, then lets it go and gives the samples dropped by the micro and reported by the frames
+static void testStall(uint32_t milliseconds, uint32_t* dropped, uint64_t* reported)
+{
+    *dropped  = uart_Stream_Dropped;
+    *reported = test_Stream.decoder.dropped;
+
+    hostUartStall(true);
+    hostRunMilliseconds(milliseconds);
+    hostUartStall(false);
+    hostRunMilliseconds(TEST_RECOVER_MS);
+    testStreamDecode(&test_Stream);
+
+    *dropped  = uart_Stream_Dropped - *dropped;
+    *reported = test_Stream.decoder.dropped - *reported;
+    HOST_CHECK(test_Stream.decoder.lostFrames == 0 && test_Stream.sequenceErrors == 0,
+               "stall of %u ms: %u lost frames, %u sequence errors", milliseconds,
+               test_Stream.decoder.lostFrames, test_Stream.sequenceErrors);
+    HOST_CHECK(test_Stream.decoder.crcErrors == 0 && test_Stream.decoder.frameErrors == 0,
+               "stall of %u ms: %u CRC errors, %u frame errors", milliseconds,
+               test_Stream.decoder.crcErrors, test_Stream.decoder.frameErrors);
+}
+
+int main(void)
+{
+    uint32_t rate;
+    uint32_t outage;
+    uint32_t dropped;
+    uint64_t reported;
+
+    hostBme280Attach(&test_Sensor, I2C2_BASE, SLAVE_ADDRESS_EXT);
+    hostBme280SetTemperature(&test_Sensor, TEST_TEMPERATURE_CENTI);
+    hostMax7219Init(1);
+    telemetryDecoderInit(&test_Stream.decoder);
+    telemetryDecoderSetStreamHandler(&test_Stream.decoder, testStreamFrame, &test_Stream);
+
+    firmwareMain();
+    test_Stream.temperature = TEST_TEMPERATURE_CENTI + sensor_Temperature_Compensation;
+    hostRunMilliseconds(TEST_RUN_MS);
+    testStreamDecode(&test_Stream);
+
+    // Every sample of the sensor is on the line or on its way to it
+    HOST_CHECK(host_Uart_Baud == UART_SPEED_STREAM, "UART0 at %u baud", host_Uart_Baud);
+    HOST_CHECK(test_Stream.frames > 0, "no stream frame");
+    HOST_CHECK(test_Stream.decoder.samples + testStreamPending() == sensor_Samples_Total,
+               "%llu samples decoded, %u pending, %u sampled", (unsigned long long)test_Stream.decoder.samples,
+               testStreamPending(), sensor_Samples_Total);
+    HOST_CHECK(test_Stream.decoder.samples == (uint64_t)test_Stream.frames * uart_Stream_Batch,
+               "%llu samples in %u frames", (unsigned long long)test_Stream.decoder.samples, test_Stream.frames);
+    HOST_CHECK(test_Stream.decoder.crcErrors == 0 && test_Stream.decoder.frameErrors == 0,
+               "%u CRC errors, %u frame errors", test_Stream.decoder.crcErrors, test_Stream.decoder.frameErrors);
+    HOST_CHECK(test_Stream.decoder.lostFrames == 0 && test_Stream.sequenceErrors == 0,
+               "%u lost frames, %u sequence errors", test_Stream.decoder.lostFrames, test_Stream.sequenceErrors);
+    HOST_CHECK(test_Stream.temperatureErrors == 0, "%u samples out of %d", test_Stream.temperatureErrors, test_Stream.temperature);
+    HOST_CHECK(uart_Stream_Dropped == 0 && test_Stream.decoder.dropped == 0, "%u samples dropped", uart_Stream_Dropped);
+
+    rate = sensor_Samples_Total * 1000u / TEST_RUN_MS;
+    printf("line              %u baud, %u samples per frame, limit %u samples/s\n", host_Uart_Baud, uart_Stream_Batch,
+           host_Uart_Baud * uart_Stream_Batch / (TEST_BITS_PER_BYTE * (TELEMETRY_STREAM_LENGTH(uart_Stream_Batch) + 2)));
+    printf("sustained         %u samples/s sampled, %u samples/s decoded\n",
+           rate, (uint32_t)(test_Stream.decoder.samples * 1000u / TEST_RUN_MS));
+
+    // The ring fills up, the first frame after it reports what was lost
+    testStall(TEST_STALL_MS, &dropped, &reported);
+    HOST_CHECK(dropped > 0 && reported == dropped, "stall: %u samples dropped, %llu reported",
+               dropped, (unsigned long long)reported);
+    printf("stall             %u ms, %u samples dropped, %llu reported\n", TEST_STALL_MS, dropped,
+           (unsigned long long)reported);
+
+    // An outage longer than the field reports UINT16_MAX, the counter of the micro keeps all of them
+    outage = (UINT16_MAX / rate + 1) * 1000u;
+    testStall(outage, &dropped, &reported);
+    HOST_CHECK(dropped > UINT16_MAX && reported == UINT16_MAX, "outage: %u samples dropped, %llu reported",
+               dropped, (unsigned long long)reported);
+    printf("outage            %u ms, %u samples dropped, %llu reported\n", outage, dropped,
+           (unsigned long long)reported);
+
+    return hostCheckResult("TelemetryStreamTest");
+}
+
+// End of file
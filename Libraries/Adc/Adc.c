@@ -0,0 +1,263 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Adc.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to sample the internal
+    temperature sensor with the ADC0 without the CPU.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    This source file is going to configure the timer trigger, the hardware
+    oversampling and the ping-pong uDMA of the ADC0, with defines in header Adc.h.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "Adc.h"
+
+// Inverse of the datasheet formula, a hotter die gives a lower code
+static uint32_t adcCodeFromCenti(int32_t centi)
+{
+    int32_t code = ((ADC_TEMP_OFFSET_CENTI - centi) * ADC_FULL_SCALE) / ADC_TEMP_SLOPE_CENTI;
+
+    if(code < 0) { code = 0; }
+    else if(code > ADC_FULL_SCALE - 1) { code = ADC_FULL_SCALE - 1; }
+    return (uint32_t)code;
+}
+
+static void adcArmBuffer(uint32_t select, uint16_t* buffer)
+{
+    uDMAChannelTransferSet(ADC_DMA_CHANNEL | select, UDMA_MODE_PINGPONG,
+                           (void *)(ADC0_BASE + ADC_O_SSFIFO1), buffer, ADC_BLOCK_LENGTH);
+}
+
+// Mean and variance of one buffer, the mean gives the die temperature of the datasheet
+static void adcProcessBlock(const uint16_t* buffer)
+{
+    uint32_t sum     = 0;
+    uint32_t squares = 0;
+    uint32_t mean;
+    uint16_t index;
+
+    for(index = 0; index < ADC_BLOCK_LENGTH; index++)
+    {
+        sum     += buffer[index];
+        squares += (uint32_t)buffer[index] * buffer[index];
+    }
+
+    mean                = (sum * ADC_CODE_SCALE) / ADC_BLOCK_LENGTH;
+    adc_Die_Temperature = ADC_TEMP_OFFSET_CENTI - (int32_t)((ADC_TEMP_SLOPE_CENTI * mean) / (ADC_FULL_SCALE * ADC_CODE_SCALE));
+    adc_Die_Variance    = (uint32_t)(((uint64_t)squares * ADC_BLOCK_LENGTH - (uint64_t)sum * sum) /
+                                     ((uint64_t)ADC_BLOCK_LENGTH * ADC_BLOCK_LENGTH));
+    adc_Blocks++;
+}
+
+void initADC0(void)
+{
+    /* ***********************************
+     *              ADC0 Config
+     * ***********************************
+     */
+    /* Enable the peripheral ADC0 and its trigger */
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC0);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_ADC0));
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER4);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER4));
+
+    /* Configure the trigger mode and prority, every step averages the conversions */
+    ADCSequenceDisable(ADC0_BASE, ADC_SEQUENCER);
+    ADCHardwareOversampleConfigure(ADC0_BASE, ADC_OVERSAMPLE_FACTOR);
+    ADCSequenceConfigure(ADC0_BASE, ADC_SEQUENCER, ADC_TRIGGER_TIMER, 0);
+
+    /* Configure the step */
+    ADCSequenceStepConfigure(ADC0_BASE, ADC_SEQUENCER, 0, ADC_CTL_TS);
+    ADCSequenceStepConfigure(ADC0_BASE, ADC_SEQUENCER, 1, ADC_CTL_TS);
+    ADCSequenceStepConfigure(ADC0_BASE, ADC_SEQUENCER, 2, ADC_CTL_TS);
+    /* Last step, its end requests the uDMA */
+    ADCSequenceStepConfigure(ADC0_BASE, ADC_SEQUENCER, 3, ADC_CTL_TS | ADC_CTL_IE | ADC_CTL_END);
+
+    /* Results of the FIFO to the buffers in turns, 4 per request like the steps */
+    uDMAChannelAssign(ADC_DMA_CHANNEL);
+    uDMAChannelAttributeDisable(ADC_DMA_CHANNEL, UDMA_ATTR_ALL);
+    uDMAChannelControlSet(ADC_DMA_CHANNEL | UDMA_PRI_SELECT, UDMA_SIZE_16 | UDMA_SRC_INC_NONE | UDMA_DST_INC_16 | UDMA_ARB_4);
+    uDMAChannelControlSet(ADC_DMA_CHANNEL | UDMA_ALT_SELECT, UDMA_SIZE_16 | UDMA_SRC_INC_NONE | UDMA_DST_INC_16 | UDMA_ARB_4);
+    adcArmBuffer(UDMA_PRI_SELECT, adc_Ping_Buffer);
+    adcArmBuffer(UDMA_ALT_SELECT, adc_Pong_Buffer);
+    uDMAChannelEnable(ADC_DMA_CHANNEL);
+
+    /* The interrupt only comes with a full buffer */
+    ADCSequenceDMAEnable(ADC0_BASE, ADC_SEQUENCER);
+    ADCIntEnableEx(ADC0_BASE, ADC_INT_DMA_SS1);
+    IntEnable(INT_ADC0SS1);
+    /* Enables conversion */
+    ADCSequenceEnable(ADC0_BASE, ADC_SEQUENCER);
+
+    /* Timeout of TIMER4A is the trigger of the sequencer */
+    TimerConfigure(TIMER4_BASE, TIMER_CFG_PERIODIC);
+    TimerControlTrigger(TIMER4_BASE, TIMER_A, true);
+    TimerADCEventSet(TIMER4_BASE, TIMER_ADC_TIMEOUT_A);
+    adcSetSampleRate(ADC_SAMPLE_RATE_HZ);
+    TimerEnable(TIMER4_BASE, TIMER_A);
+
+    /* Alarm sequencer, a step for every comparator and no FIFO results */
+    ADCSequenceConfigure(ADC0_BASE, ADC_ALARM_SEQUENCER, ADC_TRIGGER_TIMER, 1);
+    ADCSequenceStepConfigure(ADC0_BASE, ADC_ALARM_SEQUENCER, 0, ADC_CTL_TS | ADC_CTL_CMP0);
+    ADCSequenceStepConfigure(ADC0_BASE, ADC_ALARM_SEQUENCER, 1, ADC_CTL_TS | ADC_CTL_CMP1);
+    ADCSequenceStepConfigure(ADC0_BASE, ADC_ALARM_SEQUENCER, 2, ADC_CTL_TS | ADC_CTL_CMP2);
+    ADCSequenceStepConfigure(ADC0_BASE, ADC_ALARM_SEQUENCER, 3, ADC_CTL_TS | ADC_CTL_CMP3 | ADC_CTL_END);
+
+    /* Hysteresis once: every comparator interrupts a single time per entry to its band */
+    ADCComparatorConfigure(ADC0_BASE, ADC_COMP_OVER_SET, ADC_COMP_INT_LOW_HONCE);
+    ADCComparatorConfigure(ADC0_BASE, ADC_COMP_OVER_CLEAR, ADC_COMP_INT_HIGH_HONCE);
+    ADCComparatorConfigure(ADC0_BASE, ADC_COMP_UNDER_SET, ADC_COMP_INT_HIGH_HONCE);
+    ADCComparatorConfigure(ADC0_BASE, ADC_COMP_UNDER_CLEAR, ADC_COMP_INT_LOW_HONCE);
+    adcSetAlarmThresholds(adc_Alarm_Over_Centi, adc_Alarm_Under_Centi);
+    ADCComparatorIntEnable(ADC0_BASE, ADC_ALARM_SEQUENCER);
+    IntEnable(INT_ADC0SS2);
+    adcSetAlarmMode(adc_Alarm_Mode);
+}
+
+void adcSetSampleRate(uint32_t rate)
+{
+    if(rate == 0) { rate = 1; }
+    else if(rate > ADC_SAMPLE_RATE_MAX_HZ) { rate = ADC_SAMPLE_RATE_MAX_HZ; }
+
+    adc_Sample_Rate = rate;
+    TimerLoadSet(TIMER4_BASE, TIMER_A, SYSCLOCK_SPEED / rate - 1);
+}
+
+void adcSetAlarmThresholds(int32_t over, int32_t under)
+{
+    uint32_t over_Code  = adcCodeFromCenti(over);
+    uint32_t under_Code = adcCodeFromCenti(under);
+
+    adc_Alarm_Over_Centi  = over;
+    adc_Alarm_Under_Centi = under;
+
+    // Low band below the set code, high band above the release code
+    ADCComparatorRegionSet(ADC0_BASE, ADC_COMP_OVER_SET, over_Code, adcCodeFromCenti(over - ADC_ALARM_HYSTERESIS_CENTI));
+    ADCComparatorRegionSet(ADC0_BASE, ADC_COMP_OVER_CLEAR, over_Code, adcCodeFromCenti(over - ADC_ALARM_HYSTERESIS_CENTI));
+    ADCComparatorRegionSet(ADC0_BASE, ADC_COMP_UNDER_SET, adcCodeFromCenti(under + ADC_ALARM_HYSTERESIS_CENTI), under_Code);
+    ADCComparatorRegionSet(ADC0_BASE, ADC_COMP_UNDER_CLEAR, adcCodeFromCenti(under + ADC_ALARM_HYSTERESIS_CENTI), under_Code);
+
+    /* The bands start again from the next conversion */
+    ADCComparatorReset(ADC0_BASE, ADC_COMP_OVER_SET, true, true);
+    ADCComparatorReset(ADC0_BASE, ADC_COMP_OVER_CLEAR, true, true);
+    ADCComparatorReset(ADC0_BASE, ADC_COMP_UNDER_SET, true, true);
+    ADCComparatorReset(ADC0_BASE, ADC_COMP_UNDER_CLEAR, true, true);
+}
+
+void adcSetAlarmMode(bool enable)
+{
+    adc_Alarm_Mode = enable;
+    if(enable)
+    {
+        ADCSequenceDisable(ADC0_BASE, ADC_SEQUENCER);
+        ADCComparatorIntClear(ADC0_BASE, ADCComparatorIntStatus(ADC0_BASE));
+        ADCSequenceEnable(ADC0_BASE, ADC_ALARM_SEQUENCER);
+    }
+    else
+    {
+        ADCSequenceDisable(ADC0_BASE, ADC_ALARM_SEQUENCER);
+        adc_Alarm = adc_Alarm_None;
+        ADCSequenceEnable(ADC0_BASE, ADC_SEQUENCER);
+    }
+}
+
+void adcInterrupt(void)
+{
+    bool ping_Done;
+    bool pong_Done;
+
+    ADCIntClearEx(ADC0_BASE, ADC_INT_DMA_SS1);
+    profilingStart(&adc_Block_Cycles);
+
+    ping_Done = (uDMAChannelModeGet(ADC_DMA_CHANNEL | UDMA_PRI_SELECT) == UDMA_MODE_STOP);
+    pong_Done = (uDMAChannelModeGet(ADC_DMA_CHANNEL | UDMA_ALT_SELECT) == UDMA_MODE_STOP);
+    // Both full means the uDMA stopped and samples were lost
+    if(ping_Done && pong_Done) { adc_Overruns++; }
+
+    if(ping_Done)
+    {
+        adcProcessBlock(adc_Ping_Buffer);
+        adcArmBuffer(UDMA_PRI_SELECT, adc_Ping_Buffer);
+    }
+    if(pong_Done)
+    {
+        adcProcessBlock(adc_Pong_Buffer);
+        adcArmBuffer(UDMA_ALT_SELECT, adc_Pong_Buffer);
+    }
+    if(!uDMAChannelIsEnabled(ADC_DMA_CHANNEL)) { uDMAChannelEnable(ADC_DMA_CHANNEL); }
+
+    profilingStop(&adc_Block_Cycles);
+}
+
+void adcAlarmInterrupt(void)
+{
+    uint32_t status;
+    uint32_t latency;
+
+    // TIMER4 counts down from the trigger of the conversion that crossed
+    latency = TimerLoadGet(TIMER4_BASE, TIMER_A) - TimerValueGet(TIMER4_BASE, TIMER_A);
+    status  = ADCComparatorIntStatus(ADC0_BASE);
+    ADCComparatorIntClear(ADC0_BASE, status);
+
+    // A release before a set means the die went straight through the band
+    if(status & (1 << ADC_COMP_OVER_CLEAR))
+    {
+        if(adc_Alarm == adc_Alarm_Over) { adc_Alarm = adc_Alarm_None; }
+    }
+    if(status & (1 << ADC_COMP_UNDER_CLEAR))
+    {
+        if(adc_Alarm == adc_Alarm_Under) { adc_Alarm = adc_Alarm_None; }
+    }
+    if(status & (1 << ADC_COMP_OVER_SET))  { adc_Alarm = adc_Alarm_Over; }
+    if(status & (1 << ADC_COMP_UNDER_SET)) { adc_Alarm = adc_Alarm_Under; }
+
+    if(status & ((1 << ADC_COMP_OVER_SET) | (1 << ADC_COMP_UNDER_SET)))
+    {
+        adc_Alarm_Count++;
+        adc_Alarm_Latency = latency;
+        if(latency > adc_Alarm_Latency_Max) { adc_Alarm_Latency_Max = latency; }
+    }
+}
+
+// End of file
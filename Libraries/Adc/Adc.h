@@ -0,0 +1,273 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Adc.h
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a header file for C language. The purpose is to
+    sample the internal temperature sensor of the micro with the ADC0.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    TIMER4 starts the sequencer 1 of the ADC0, the hardware averages every
+    conversion and the uDMA moves the results to two buffers in turns. The
+    interrupt of a full buffer publishes the die temperature and its noise.
+    In alarm mode the stream stops and the digital comparators watch the same
+    trigger, the CPU only runs when the temperature crosses a threshold.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#ifndef LIBRARIES_ADC_ADC_H_
+#define LIBRARIES_ADC_ADC_H_
+
+/* *****************************************************************
+ *                        Included files
+ * *****************************************************************
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_adc.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/adc.h"
+#include "driverlib/timer.h"
+#include "driverlib/udma.h"
+#include "driverlib/interrupt.h"
+#include "../Profiling/Profiling.h"
+
+/* *****************************************************************
+ *                        Macros
+ * *****************************************************************
+ */
+
+#undef SYSCLOCK_SPEED
+#define SYSCLOCK_SPEED (uint32_t) 120000000
+
+// Sequencer 1, four steps of the temperature sensor per trigger
+#define ADC_SEQUENCER             1
+#define ADC_SEQUENCER_STEPS       4
+
+// Conversions averaged by the hardware for every step, 2 to 64
+#define ADC_OVERSAMPLE_FACTOR     64
+
+// Triggers per second, 4 steps of 64 conversions take 256 us at 1 Msps
+#define ADC_SAMPLE_RATE_HZ        1000
+#define ADC_SAMPLE_RATE_MAX_HZ    2000
+
+// Results per buffer, the sum of squares of 12 bit codes fits 32 bits up to 256
+#define ADC_BLOCK_LENGTH          128
+
+// ADC0 SS1 of table 9-1 (uDMA channel assignments) of the TM4C1294 datasheet
+#define ADC_DMA_CHANNEL           UDMA_CH15_ADC0_1
+
+// TEMP = 147.5 - (75 * 3.3 V * code) / 4096, in centi-degrees with the code scaled by 16
+#define ADC_CODE_SCALE            16
+#define ADC_TEMP_OFFSET_CENTI     14750
+#define ADC_TEMP_SLOPE_CENTI      24750
+#define ADC_FULL_SCALE            4096
+
+// Sequencer 2 feeds one comparator per step, its results never reach the FIFO
+#define ADC_ALARM_SEQUENCER       2
+#define ADC_COMP_OVER_SET         0
+#define ADC_COMP_OVER_CLEAR       1
+#define ADC_COMP_UNDER_SET        2
+#define ADC_COMP_UNDER_CLEAR      3
+
+// Default thresholds and the band the temperature must go back to release an alarm
+#define ADC_ALARM_OVER_CENTI      8500
+#define ADC_ALARM_UNDER_CENTI     (-1000)
+#define ADC_ALARM_HYSTERESIS_CENTI 300
+
+/* *****************************************************************
+ *                       Data types
+ * *****************************************************************
+ */
+
+typedef enum
+{
+    adc_Alarm_None  ,
+    adc_Alarm_Over  ,
+    adc_Alarm_Under
+}AdcAlarm;
+
+/* *****************************************************************
+ *                       Function variables
+ * *****************************************************************
+ */
+
+extern uint16_t          adc_Ping_Buffer[ADC_BLOCK_LENGTH];
+extern uint16_t          adc_Pong_Buffer[ADC_BLOCK_LENGTH];
+extern volatile int32_t  adc_Die_Temperature;
+extern volatile uint32_t adc_Die_Variance;
+extern uint32_t          adc_Sample_Rate;
+extern uint32_t          adc_Blocks;
+extern uint32_t          adc_Overruns;
+extern ProfilingCounter  adc_Block_Cycles;
+extern volatile AdcAlarm adc_Alarm;
+extern bool              adc_Alarm_Mode;
+extern int32_t           adc_Alarm_Over_Centi;
+extern int32_t           adc_Alarm_Under_Centi;
+extern uint32_t          adc_Alarm_Count;
+extern uint32_t          adc_Alarm_Latency;
+extern uint32_t          adc_Alarm_Latency_Max;
+
+/* *****************************************************************
+ *                       Function prototypes
+ * *****************************************************************
+ */
+
+/**
+*****************************************************************************
+*
+*  @brief Initialize the ADC0, TIMER4 and the uDMA channel of the internal temperature
+*
+*  @b example
+*  @code
+*      void initADC0();
+*  @endcode
+*
+*  @note
+*      The uDMA and its control table must be initialized by the board before
+*
+******************************************************************************
+*/
+
+void initADC0(void);
+
+/**
+*****************************************************************************
+*
+*  @brief Changes the triggers per second of the sequencer
+*
+*  @param[in]   rate        Triggers per second, 1 to ADC_SAMPLE_RATE_MAX_HZ
+*
+*  @b example
+*  @code
+*      adcSetSampleRate(ADC_SAMPLE_RATE_MAX_HZ);
+*  @endcode
+*
+*  @note
+*      Out of range rates are clamped, every trigger gives ADC_SEQUENCER_STEPS results
+*
+******************************************************************************
+*/
+
+void adcSetSampleRate(uint32_t rate);
+
+/**
+*****************************************************************************
+*
+*  @brief Interrupt of the sequencer, processes the full buffers and gives them back to the uDMA
+*
+*  @b example
+*  @code
+*      void adcInterrupt();
+*  @endcode
+*
+*  @note
+*      Updates adc_Die_Temperature in centi-degrees and adc_Die_Variance in codes^2
+*
+******************************************************************************
+*/
+
+void adcInterrupt(void);
+
+/**
+*****************************************************************************
+*
+*  @brief Changes the temperatures of the over and under alarms
+*
+*  @param[in]   over        Over temperature in centi-degrees
+*  @param[in]   under       Under temperature in centi-degrees, lower than over
+*
+*  @b example
+*  @code
+*      adcSetAlarmThresholds(ADC_ALARM_OVER_CENTI, ADC_ALARM_UNDER_CENTI);
+*  @endcode
+*
+*  @note
+*      An alarm is released ADC_ALARM_HYSTERESIS_CENTI inside the threshold
+*
+******************************************************************************
+*/
+
+void adcSetAlarmThresholds(int32_t over, int32_t under);
+
+/**
+*****************************************************************************
+*
+*  @brief Switches between the uDMA stream and the comparator alarms
+*
+*  @param[in]   enable      true stops the stream and starts the comparators
+*
+*  @b example
+*  @code
+*      adcSetAlarmMode(true);
+*  @endcode
+*
+*  @note
+*      Both modes use the TIMER4 trigger, the rate of adcSetSampleRate applies
+*
+******************************************************************************
+*/
+
+void adcSetAlarmMode(bool enable);
+
+/**
+*****************************************************************************
+*
+*  @brief Interrupt of the comparators, updates adc_Alarm on a threshold crossing
+*
+*  @b example
+*  @code
+*      void adcAlarmInterrupt();
+*  @endcode
+*
+*  @note
+*      adc_Alarm_Latency is the cycles since the TIMER4 trigger of the conversion
+*
+******************************************************************************
+*/
+
+void adcAlarmInterrupt(void);
+
+#endif /* LIBRARIES_ADC_ADC_H_ */
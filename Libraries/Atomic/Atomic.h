@@ -0,0 +1,148 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Atomic.h
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a header file for C language. The purpose is to
+    give the lock-free rings one compare and swap for the interrupts.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The functions are inline, every ring keeps its claims without a call.
+    On the core they use LDREX/STREX: the STREX fails if an interrupt came
+    in between, so they are atomic on a single core without disabling the
+    interrupts. On the host they use the builtins of GCC.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#ifndef LIBRARIES_ATOMIC_ATOMIC_H_
+#define LIBRARIES_ATOMIC_ATOMIC_H_
+
+/* *****************************************************************
+ *                        Included files
+ * *****************************************************************
+ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* *****************************************************************
+ *                        Macros
+ * *****************************************************************
+ */
+
+// Keeps the writes of a slot before the flag that publishes it, the dmb of CMSIS on the core
+#if defined(__TI_COMPILER_VERSION__)
+#define ATOMIC_BARRIER()       __asm("  dmb")
+#else
+#define ATOMIC_BARRIER()       __asm volatile("" ::: "memory")
+#endif
+
+/* *****************************************************************
+ *                        Inline functions
+ * *****************************************************************
+ */
+
+/**
+*****************************************************************************
+*
+*  @brief Writes a new value only if nobody changed the old one
+*
+*  @param[in,out]   value       Shared value
+*  @param[in]       expected    Value read before
+*  @param[in]       desired     New value
+*
+*  @return      true if the value was written
+*
+*  @b example
+*  @code
+*      }while(!atomicCompareAndSwap(&ring.head, head, head + 1));
+*  @endcode
+*
+*  @note
+*      Safe from tasks, Swis and Hwis, a false return is retried by the caller
+*
+******************************************************************************
+*/
+
+static inline bool atomicCompareAndSwap(volatile uint32_t* value, uint32_t expected, uint32_t desired)
+{
+#if defined(__TI_COMPILER_VERSION__)
+    if(__ldrex((void *)value) != expected)
+    {
+        __clrex();
+        return false;
+    }
+    return (__strex(desired, (void *)value) == 0);
+#else
+    return __sync_bool_compare_and_swap(value, expected, desired);
+#endif
+}
+
+/**
+*****************************************************************************
+*
+*  @brief Adds to a shared counter
+*
+*  @param[in,out]   value       Shared counter
+*  @param[in]       amount      Amount to be added
+*
+*  @b example
+*  @code
+*      atomicAdd(&ring.overflows, 1);
+*  @endcode
+*
+*  @note
+*      Safe from tasks, Swis and Hwis
+*
+******************************************************************************
+*/
+
+static inline void atomicAdd(volatile uint32_t* value, uint32_t amount)
+{
+    uint32_t current;
+
+    do
+    {
+        current = *value;
+    }while(!atomicCompareAndSwap(value, current, current + amount));
+}
+
+#endif /* LIBRARIES_ATOMIC_ATOMIC_H_ */
@@ -53,16 +53,42 @@
 */
 
 #include "Display.h"
+#include "DisplayTables.h"
+
+#if DISPLAY_TRANSPORT == DISPLAY_TRANSPORT_SSI
+// Frame owned by the driver while the SSI sends it
+static uint16_t display_Dma_Frame[DISPLAY_FRAME_MAX_WORDS] = { 0 };
+#if DISPLAY_CHAIN_LENGTH > 1
+static uint8_t  display_Frame_Row    = 0;
+static uint8_t  display_Frame_Rows   = 0;
+#endif
+#endif
+static volatile bool        display_Frame_Busy     = false;
+static DisplayFrameCallback display_Frame_Callback = NULL;
+
+// Digits being rendered and digits already latched by every MAX7219
+static DisplayPanel display_Panels[DISPLAY_CHAIN_LENGTH];
+
+ProfilingCounter display_Frame_Cycles  = { 0 };
+uint32_t         display_Words_Sent    = 0;
+uint32_t         display_Words_Skipped = 0;
+uint32_t         display_Rows_Sent     = 0;
+
+static void trackDigit(DisplayHandle panel, uint8_t registerAddress, uint8_t registerValue)
+{
+    // Keeps the shadow equal to what the MAX7219 holds
+    if(registerAddress >= OP_DIGIT0 && registerAddress <= OP_DIGIT7)
+    {
+        panel->shadow[registerAddress - OP_DIGIT0] = registerValue;
+    }
+}
 
-void SpiSend(uint8_t registerAddress, uint8_t registerValue )
+#if DISPLAY_TRANSPORT == DISPLAY_TRANSPORT_BITBANG
+static void bitBangShift(uint8_t registerAddress, uint8_t registerValue)
 {
     uint8_t genericCounter        = 0;
     static const uint8_t ui8Delay = 5;
 
-    // Turns off the PORTN to send information
-    GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_3,0x00);
-    SysCtlDelay(ui8Delay);
-
     // Generates a cycle to send the information bit by bit
     // First send the registeAddress corresponding to the datasheet
     for( genericCounter = 8; genericCounter > 0; genericCounter--)
@@ -109,19 +135,256 @@ void SpiSend(uint8_t registerAddress, uint8_t registerValue )
         GPIOPinWrite(GPIO_PORTD_BASE, GPIO_PIN_3,0x08);
         SysCtlDelay(ui8Delay);
     }
-    // Ends the transmission of the information
+}
+
+static void bitBangRow(const uint16_t* row)
+{
+    uint8_t indexCounter          = 0;
+    static const uint8_t ui8Delay = 5;
+
+    // Turns off the PORTN to send information
+    GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_3,0x00);
+    SysCtlDelay(ui8Delay);
+
+    // Every word pushes the previous one to the next MAX7219 of the chain
+    for(indexCounter = 0; indexCounter < DISPLAY_CHAIN_LENGTH; indexCounter++)
+    {
+        bitBangShift((uint8_t)(row[indexCounter] >> 8), (uint8_t)row[indexCounter]);
+    }
+
+    // Ends the transmission of the information, all the chain latches its word
     GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_3,0x08);
 }
+#endif
+
+#if DISPLAY_TRANSPORT == DISPLAY_TRANSPORT_SSI && DISPLAY_CHAIN_LENGTH > 1
+static void ssiPushRow(const uint16_t* row)
+{
+    uint8_t indexCounter = 0;
+
+    // The row fits in the FIFO, the FSS stays low until it is empty
+    for(indexCounter = 0; indexCounter < DISPLAY_CHAIN_LENGTH; indexCounter++)
+    {
+        SSIDataPut(SSI2_BASE, row[indexCounter]);
+    }
+}
+#endif
+
+void SpiSend(uint8_t registerAddress, uint8_t registerValue )
+{
+    uint8_t  indexCounter = 0;
+    uint16_t row[DISPLAY_CHAIN_LENGTH];
+
+    // The same register is written in all the chain
+    for(indexCounter = 0; indexCounter < DISPLAY_CHAIN_LENGTH; indexCounter++)
+    {
+        row[indexCounter] = DISPLAY_WORD(registerAddress, registerValue);
+        trackDigit(&display_Panels[indexCounter], registerAddress, registerValue);
+    }
+#if DISPLAY_TRANSPORT == DISPLAY_TRANSPORT_SSI
+    // Single writes share the FIFO with the frames, waits for the frame in progress
+    while(display_Frame_Busy);
+#if DISPLAY_CHAIN_LENGTH > 1
+    ssiPushRow(row);
+    // The next row needs its own LOAD pulse
+    while(SSIBusy(SSI2_BASE));
+#else
+    // Blocks only if the 8 words FIFO is full, the FSS latches every word
+    SSIDataPut(SSI2_BASE, row[0]);
+#endif
+#else
+    bitBangRow(row);
+#endif
+}
+
+bool displaySendFrame(const uint16_t* frame, uint8_t length, DisplayFrameCallback callback)
+{
+    uint8_t indexCounter = 0;
+
+    // Only the state machine task sends frames, no need to lock the flag
+    if(display_Frame_Busy || length == 0 || length > DISPLAY_FRAME_MAX_WORDS || (length % DISPLAY_CHAIN_LENGTH) != 0)
+    {
+        return false;
+    }
+
+    profilingStart(&display_Frame_Cycles);
+    display_Frame_Callback = callback;
+
+    // The first word of every row goes to the last panel of the chain
+    for(indexCounter = 0; indexCounter < length; indexCounter++)
+    {
+        trackDigit(&display_Panels[DISPLAY_CHAIN_LENGTH - 1 - (indexCounter % DISPLAY_CHAIN_LENGTH)],
+                   (uint8_t)(frame[indexCounter] >> 8), (uint8_t)frame[indexCounter]);
+    }
+    display_Rows_Sent += length / DISPLAY_CHAIN_LENGTH;
+
+#if DISPLAY_TRANSPORT == DISPLAY_TRANSPORT_SSI
+    for(indexCounter = 0; indexCounter < length; indexCounter++)
+    {
+        display_Dma_Frame[indexCounter] = frame[indexCounter];
+    }
+    display_Frame_Busy = true;
+    SSIIntClear(SSI2_BASE, SSI_DMATX | SSI_TXEOT);
+
+#if DISPLAY_CHAIN_LENGTH > 1
+    // One row at a time, the end of transmission interrupt sends the next one
+    display_Frame_Row  = 1;
+    display_Frame_Rows = length / DISPLAY_CHAIN_LENGTH;
+    ssiPushRow(display_Dma_Frame);
+    SSIIntEnable(SSI2_BASE, SSI_TXEOT);
+#else
+    // The uDMA fills the SSI FIFO, the CPU is free until the interrupt
+    uDMAChannelTransferSet(UDMA_CH13_SSI2TX | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                           display_Dma_Frame, (void *)(SSI2_BASE + SSI_O_DR), length);
+    SSIIntEnable(SSI2_BASE, SSI_DMATX);
+    uDMAChannelEnable(UDMA_CH13_SSI2TX);
+#endif
+    profilingStop(&display_Frame_Cycles);
+#else
+    for(indexCounter = 0; indexCounter < length; indexCounter += DISPLAY_CHAIN_LENGTH)
+    {
+        bitBangRow(&frame[indexCounter]);
+    }
+    profilingStop(&display_Frame_Cycles);
+
+    if(display_Frame_Callback != NULL)
+    {
+        display_Frame_Callback();
+    }
+#endif
+    return true;
+}
+
+bool displayFrameBusy(void)
+{
+    return display_Frame_Busy;
+}
+
+DisplayHandle displayGetPanel(const uint8_t position)
+{
+    if(position >= DISPLAY_CHAIN_LENGTH)
+    {
+        return NULL;
+    }
+    return &display_Panels[position];
+}
+
+void displayFlush(void)
+{
+    uint8_t  digitCounter = 0, panelCounter = 0, frameLength = 0, changedDigits = 0;
+    bool     rowChanged = false;
+    uint16_t frame[DISPLAY_FRAME_MAX_WORDS];
+    DisplayHandle panel;
+
+    // Only the rows with a digit different from the shadow go to the wire,
+    // the panels that did not change in that row receive a NOOP
+    for(digitCounter = 0; digitCounter < DISPLAY_MAX_LENGTH; digitCounter++)
+    {
+        rowChanged = false;
+        for(panelCounter = 0; panelCounter < DISPLAY_CHAIN_LENGTH; panelCounter++)
+        {
+            // The first word shifted reaches the last panel of the chain
+            panel = &display_Panels[DISPLAY_CHAIN_LENGTH - 1 - panelCounter];
+            if(panel->frameBuffer[digitCounter] != panel->shadow[digitCounter])
+            {
+                frame[frameLength + panelCounter] = DISPLAY_WORD(digitCounter + OP_DIGIT0, panel->frameBuffer[digitCounter]);
+                rowChanged = true;
+                changedDigits++;
+            }
+            else
+            {
+                frame[frameLength + panelCounter] = DISPLAY_WORD(OP_NOOP, 0x00);
+            }
+        }
+        if(rowChanged)
+        {
+            frameLength += DISPLAY_CHAIN_LENGTH;
+        }
+    }
+
+    if(frameLength == 0)
+    {
+        display_Words_Skipped += DISPLAY_MAX_LENGTH * DISPLAY_CHAIN_LENGTH;
+    }
+    // If the previous frame is still on the wire the shadow keeps the old
+    // digits, so they are sent again in the next flush
+    else if(displaySendFrame(frame, frameLength, NULL))
+    {
+        display_Words_Sent    += changedDigits;
+        display_Words_Skipped += DISPLAY_MAX_LENGTH * DISPLAY_CHAIN_LENGTH - changedDigits;
+    }
+}
+
+void displaySsiInterrupt(void)
+{
+#if DISPLAY_TRANSPORT == DISPLAY_TRANSPORT_SSI
+    uint32_t ui32SsiInterruptStatus = SSIIntStatus(SSI2_BASE, true);
+
+    SSIIntClear(SSI2_BASE, ui32SsiInterruptStatus);
+
+    if(ui32SsiInterruptStatus & SSI_DMATX)
+    {
+        // The uDMA is done but the FIFO still has words, waits until it is empty
+        SSIIntDisable(SSI2_BASE, SSI_DMATX);
+        SSIIntEnable(SSI2_BASE, SSI_TXEOT);
+    }
+    if(ui32SsiInterruptStatus & SSI_TXEOT)
+    {
+#if DISPLAY_CHAIN_LENGTH > 1
+        // The FSS went high and the chain latched the row, sends the next one
+        if(display_Frame_Row < display_Frame_Rows)
+        {
+            ssiPushRow(&display_Dma_Frame[display_Frame_Row * DISPLAY_CHAIN_LENGTH]);
+            display_Frame_Row++;
+            return;
+        }
+#endif
+        SSIIntDisable(SSI2_BASE, SSI_TXEOT);
+        display_Frame_Busy = false;
+        if(display_Frame_Callback != NULL)
+        {
+            display_Frame_Callback();
+        }
+    }
+#endif
+}
 
 //Initialize the PORT N3 and PORT D1, D3 to use the SPI protocol
 void initDisplay(void)
 {
     uint8_t  indexCounter = 0;
+#if DISPLAY_TRANSPORT == DISPLAY_TRANSPORT_SSI
+    // SSI2 on PD1, PD2 & PD3, the uDMA must be already initialized by the board
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOD);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_SSI2);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_SSI2));
+
+    GPIOPinConfigure(GPIO_PD3_SSI2CLK);
+    GPIOPinConfigure(GPIO_PD2_SSI2FSS);
+    GPIOPinConfigure(GPIO_PD1_SSI2XDAT0);
+    GPIOPinTypeSSI(GPIO_PORTD_BASE, GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3);
+
+    // Mode 0 pulses the FSS high between words, that is the LOAD of the MAX7219.
+    // Mode 3 keeps it low for the whole row that a chain needs
+    SSIConfigSetExpClk(SSI2_BASE, SYSCLOCK_SPEED, DISPLAY_SSI_FRAME_FORMAT, SSI_MODE_MASTER,
+                       DISPLAY_SSI_BITRATE, DISPLAY_SSI_WORDSIZE);
+    SSIEnable(SSI2_BASE);
+
+#if DISPLAY_CHAIN_LENGTH == 1
+    uDMAChannelAssign(UDMA_CH13_SSI2TX);
+    uDMAChannelAttributeDisable(UDMA_CH13_SSI2TX, UDMA_ATTR_ALL);
+    uDMAChannelControlSet(UDMA_CH13_SSI2TX | UDMA_PRI_SELECT,
+                          UDMA_SIZE_16 | UDMA_SRC_INC_16 | UDMA_DST_INC_NONE | UDMA_ARB_4);
+    SSIDMAEnable(SSI2_BASE, SSI_DMA_TX);
+#endif
+    IntEnable(INT_SSI2);
+#else
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPION | SYSCTL_PERIPH_GPIOD);
     GPIOPinTypeGPIOOutput(GPIO_PORTN_BASE, GPIO_PIN_3);
     GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_3,0x08);
 
     GPIOPinTypeGPIOOutput(GPIO_PORTD_BASE, GPIO_PIN_1|GPIO_PIN_3);
+#endif
 
     SpiSend(OP_DISPLAYTEST, DISPLAY_TEST_NORMAL_OPERATION);
     SpiSend(OP_INTENSITY,   0x01);
@@ -148,18 +411,30 @@ void cleanDisplay(void)
     }
 }
 
-//Display the string
-void displayTempValue(const float tempValue)
+void displayPanelClear(DisplayHandle panel)
 {
-    float floatValue = tempValue*FLOATING_POINT_MULTIPLIER;
-    int  indexCounter = 0, auxValue = abs(floatValue), digitValue = 0 ;
+    uint8_t  indexCounter = 0;
+    for( indexCounter = 0; indexCounter < DISPLAY_MAX_LENGTH; indexCounter++)
+    {
+        panel->frameBuffer[indexCounter] = 0x00;
+    }
+}
 
-    //Clean the display
-    cleanDisplay();
+void displayPanelDigit(DisplayHandle panel, const uint8_t digitAddress, const uint8_t digitValue)
+{
+    // Drops the digits out of the display, same as the MAX7219 with NOOP
+    if(digitAddress >= OP_DIGIT0 && digitAddress <= OP_DIGIT7)
+    {
+        panel->frameBuffer[digitAddress - OP_DIGIT0] = digitValue;
+    }
+}
 
-    //Displays degree
-    SpiSend(OP_DIGIT0, SEVEN_DIGIT_DISPLAY_C_LETTER_CL);
-    SpiSend(OP_DIGIT1, SEVEN_DIGIT_DISPLAY_DEGREE);
+// Used only for values out of the tables, it never happens with the sensor clamp
+static void renderTempDigits(DisplayHandle panel, int auxValue, const bool negativeValue)
+{
+    char    digits[FORMAT_UNSIGNED_MAX_LENGTH + 1];
+    int     indexCounter = 0;
+    uint8_t digitIndex, digitCount;
 
     // Validates max possible value
     if(auxValue >= 1000000)
@@ -167,107 +442,114 @@ void displayTempValue(const float tempValue)
         auxValue = 99999;
     }
 
-    //Begin cycle to convert the int value to array
-    /* This do-while covers 3 possible cases
-     * 1. When the value is different from 0 the cycle does its routine at least two times.
-     * 2. When the value is equal to cero it displays 0.0
-     * 3. When the value is above 5 digits it does not displays everything
-     */
+    // A leading 0 is kept for values under 1.0, the display always shows 0.0 at least
+    digits[0]  = '0';
+    digitCount = formatUnsigned(&digits[1], (uint32_t)auxValue) + 1;
+    digitIndex = (digitCount > 2) ? 1 : 0;
+
+    // The last digit goes to the right, the digits after the display are not shown
     indexCounter = OP_DIGIT2;
-    do
+    while(digitCount > digitIndex && indexCounter < DISPLAY_MAX_LENGTH)
     {
-        digitValue = auxValue % 10 ;
-        auxValue = (auxValue - digitValue)/10;
+        digitCount--;
         if(indexCounter == OP_DIGIT3)
         {
             // Adds the decimal point to the value
-            SpiSend(indexCounter, sevenDigitDisplayMatrix[digitValue] | 0x80);
+            displayPanelDigit(panel, indexCounter, sevenDigitDisplayMatrix[digits[digitCount] - '0'] | SEVEN_DIGIT_DISPLAY_POINT);
         }
         else
         {
-            SpiSend(indexCounter, sevenDigitDisplayMatrix[digitValue]);
+            displayPanelDigit(panel, indexCounter, sevenDigitDisplayMatrix[digits[digitCount] - '0']);
         }
         indexCounter++;
-    }while(auxValue > 0 && indexCounter < DISPLAY_MAX_LENGTH || indexCounter < OP_DIGIT4);
+    }
     //Obtain sign
-    if(tempValue < 0)
+    if(negativeValue)
     {
-        SpiSend(indexCounter, SEVEN_DIGIT_DISPLAY_MINUS);
+        displayPanelDigit(panel, indexCounter, SEVEN_DIGIT_DISPLAY_MINUS);
     }
 }
 
-//Display the string
-void displayTime(const uint8_t hours, const uint8_t minutes)
+void displayPanelTempValue(DisplayHandle panel, const int32_t tempTenths)
 {
-    int  indexCounter = 0, auxHours = abs(hours), auxMinutes = abs(minutes), digitValue = 0, displayCounter = 0;
-    static bool ampmFlag = false;
+    bool negativeValue = tempTenths < 0;
+    int  auxValue      = negativeValue ? -tempTenths : tempTenths;
+
     //Clean the display
-    cleanDisplay();
+    displayPanelClear(panel);
 
-    // Max possible hour
-    if(auxHours < HOUR_FORMAT_12)
-    {
-        ampmFlag = false;
-    }
-    else
+    //Displays degree
+    displayPanelDigit(panel, OP_DIGIT0, SEVEN_DIGIT_DISPLAY_C_LETTER_CL);
+    displayPanelDigit(panel, OP_DIGIT1, SEVEN_DIGIT_DISPLAY_DEGREE);
+
+    if(auxValue <= DISPLAY_TEMP_TABLE_MAX_TENTHS)
     {
-        if(auxHours >= HOUR_FORMAT_12 && auxHours != BLANK_VALUE_DISPLAY)
+        // Segments are already calculated, only copied to the framebuffer
+        displayPanelDigit(panel, OP_DIGIT2, displayTempTable[auxValue][0]);
+        displayPanelDigit(panel, OP_DIGIT3, displayTempTable[auxValue][1]);
+        displayPanelDigit(panel, OP_DIGIT4, displayTempTable[auxValue][2]);
+        //Obtain sign, on the first digit not used by the value
+        if(negativeValue)
         {
-            auxHours = auxHours - 12;
-            ampmFlag = true;
-        }
-        else
-        {
-            if(auxHours >= HOUR_FORMAT_24 && auxHours != BLANK_VALUE_DISPLAY)
-            {
-                auxHours = 0;
-            }
+            displayPanelDigit(panel, auxValue < DISPLAY_TEMP_TWO_DIGITS_LIMIT ? OP_DIGIT4 : OP_DIGIT5, SEVEN_DIGIT_DISPLAY_MINUS);
         }
     }
-
-
-    //Max possible minutes
-    if(auxMinutes >= MINUTES_MAX_VALUE && auxMinutes != BLANK_VALUE_DISPLAY)
+    else
     {
-        auxMinutes = 0;
+        renderTempDigits(panel, auxValue, negativeValue);
     }
+}
+
+void displayPanelTime(DisplayHandle panel, const uint8_t hours, const uint8_t minutes)
+{
+    uint8_t tableIndex = 0;
+    //Clean the display
+    displayPanelClear(panel);
 
     // Displays minutes if the value is different of 99
-    if(auxMinutes != BLANK_VALUE_DISPLAY)
+    if(minutes != BLANK_VALUE_DISPLAY)
     {
-        indexCounter = OP_DIGIT3;
-        // Displays minutes in two cycles
-        for( displayCounter = 0; displayCounter < 2; displayCounter++)
-        {
-            digitValue = auxMinutes % 10;
-            auxMinutes = (auxMinutes - digitValue)/10;
-            SpiSend(indexCounter, sevenDigitDisplayMatrix[digitValue]);
-            indexCounter++;
-        }
+        // Out of range minutes are shown as 00
+        tableIndex = (minutes < MINUTES_MAX_VALUE) ? minutes : 0;
+        displayPanelDigit(panel, OP_DIGIT3, displayMinutesTable[tableIndex][0]);
+        displayPanelDigit(panel, OP_DIGIT4, displayMinutesTable[tableIndex][1]);
     }
     // Displays hours if the value is different of 99
-    if(auxHours != BLANK_VALUE_DISPLAY)
+    if(hours != BLANK_VALUE_DISPLAY)
     {
-        indexCounter = OP_DIGIT5;
-        // Displays hours in maybe two cycles
-        digitValue = auxHours % 10;
-        auxHours   = (auxHours - digitValue)/10;
-        SpiSend(indexCounter, sevenDigitDisplayMatrix[digitValue] | 0x80);
-        indexCounter++;
-        if(auxHours > 0 )
-        {
-            digitValue = auxHours % 10;
-            auxHours   = (auxHours - digitValue)/10;
-            SpiSend(indexCounter, sevenDigitDisplayMatrix[digitValue]);
-        }
+        // Out of range hours are shown as 0
+        tableIndex = (hours < HOUR_FORMAT_24) ? hours : 0;
+        displayPanelDigit(panel, OP_DIGIT5, displayHoursTable[tableIndex][DISPLAY_HOURS_UNITS]);
+        displayPanelDigit(panel, OP_DIGIT6, displayHoursTable[tableIndex][DISPLAY_HOURS_TENS]);
+        panel->ampmSegments = displayHoursTable[tableIndex][DISPLAY_HOURS_PM];
     }
 
     // Displays an h at the end to indicate time
-    SpiSend(OP_DIGIT0, SEVEN_DIGIT_DISPLAY_H_LETTER_LC);
-    if(ampmFlag)
-    {
-        SpiSend(OP_DIGIT1, SEVEN_DIGIT_DISPLAY_DEGREE);
-    }
+    displayPanelDigit(panel, OP_DIGIT0, SEVEN_DIGIT_DISPLAY_H_LETTER_LC);
+    // The PM symbol is kept while the hours blink
+    displayPanelDigit(panel, OP_DIGIT1, panel->ampmSegments);
+}
+
+//Display the string
+void displayTempValue(const int32_t tempTenths)
+{
+    displayPanelTempValue(&display_Panels[0], tempTenths);
+    displayFlush();
+}
+
+//Display the string and the status
+void displayTempValueStatus(const int32_t tempTenths, const uint8_t statusSegments)
+{
+    displayPanelTempValue(&display_Panels[0], tempTenths);
+    displayPanelDigit(&display_Panels[0], OP_DIGIT7, statusSegments);
+    displayFlush();
+}
+
+//Display the string
+void displayTime(const uint8_t hours, const uint8_t minutes)
+{
+    displayPanelTime(&display_Panels[0], hours, minutes);
+    displayFlush();
 }
 
 void displayTest(void)
@@ -27,6 +27,8 @@
     This source file is going to implement the SPI module of the microcontroller
     to communicate it with a 7-digit segment and the serial controller MAX7219.
     The system will use the pins PD1 - MOSI, PN3 - CS & PD3 - SPI CLK.
+    With the SSI transport the CS moves to PD2 - SSI2FSS and the frames
+    are sent by the uDMA.
 
 
     Generation Information :
@@ -61,14 +63,23 @@
  */
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include <math.h>
 
 #include "inc/hw_types.h"
 #include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_ssi.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
 #include "driverlib/sysctl.h"
+#include "driverlib/pin_map.h"
+#include "driverlib/ssi.h"
+#include "driverlib/udma.h"
+#include "driverlib/interrupt.h"
 #include "SevenDigitMacros.h"
+#include "../Profiling/Profiling.h"
+#include "../Format/Format.h"
 /* *****************************************************************
  *                        Macros
  * *****************************************************************
@@ -116,7 +127,83 @@
 #undef MINUTES_MAX_VALUE
 #define MINUTES_MAX_VALUE 60
 
-#define FLOATING_POINT_MULTIPLIER 10
+// Define the processor speed
+#undef SYSCLOCK_SPEED
+#define SYSCLOCK_SPEED (uint32_t) 120000000
+
+// Transports available to reach the MAX7219
+// BITBANG: PD1 - MOSI, PD3 - CLK & PN3 - CS driven by software
+// SSI:     SSI2 with uDMA, PD1 - SSI2XDAT0, PD3 - SSI2CLK & PD2 - SSI2FSS,
+//          the FSS pulses high between words so LOAD must be wired to PD2
+#define DISPLAY_TRANSPORT_BITBANG 0
+#define DISPLAY_TRANSPORT_SSI     1
+
+#ifndef DISPLAY_TRANSPORT
+#define DISPLAY_TRANSPORT DISPLAY_TRANSPORT_SSI
+#endif
+
+// Number of MAX7219 daisy chained with DOUT to DIN, all share CLK and LOAD.
+// The position 0 is the one connected to the micro
+#ifndef DISPLAY_CHAIN_LENGTH
+#define DISPLAY_CHAIN_LENGTH 1
+#endif
+
+// A row of the chain must fit in the 8 words SSI FIFO
+#define DISPLAY_MAX_CHAIN_LENGTH 8
+#if DISPLAY_CHAIN_LENGTH < 1 || DISPLAY_CHAIN_LENGTH > DISPLAY_MAX_CHAIN_LENGTH
+#error "DISPLAY_CHAIN_LENGTH must be between 1 and DISPLAY_MAX_CHAIN_LENGTH"
+#endif
+
+// One word per digit for every panel of the chain
+#define DISPLAY_FRAME_MAX_WORDS (DISPLAY_MAX_LENGTH * DISPLAY_CHAIN_LENGTH)
+
+// The MAX7219 accepts up to 10 MHz, 2 MHz leaves margin for the wiring
+#define DISPLAY_SSI_BITRATE  2000000
+#define DISPLAY_SSI_WORDSIZE 16
+
+// Mode 0 latches every word, mode 3 keeps the LOAD low during a whole row.
+// Both shift the data in the rising edge of the clock as the MAX7219 needs
+#if DISPLAY_CHAIN_LENGTH > 1
+#define DISPLAY_SSI_FRAME_FORMAT SSI_FRF_MOTO_MODE_3
+#else
+#define DISPLAY_SSI_FRAME_FORMAT SSI_FRF_MOTO_MODE_0
+#endif
+
+// Builds the 16 bit word of a register write
+#define DISPLAY_WORD(registerAddress, registerValue) \
+    (uint16_t)(((uint16_t)(registerAddress) << 8) | (uint8_t)(registerValue))
+
+/* *****************************************************************
+ *                        Definitions
+ * *****************************************************************
+ */
+
+// Called when the last word of a frame has left the transport
+typedef void (*DisplayFrameCallback)(void);
+
+// Digits being rendered and digits already latched by one MAX7219 of the chain
+typedef struct
+{
+    uint8_t frameBuffer[DISPLAY_MAX_LENGTH];
+    uint8_t shadow[DISPLAY_MAX_LENGTH];
+    uint8_t ampmSegments;
+}DisplayPanel;
+
+typedef DisplayPanel* DisplayHandle;
+
+/* *****************************************************************
+ *                       Global variables
+ * *****************************************************************
+ */
+
+// Cycles spent by the CPU on every frame, to compare the transports
+extern ProfilingCounter display_Frame_Cycles;
+
+// Digit writes sent and avoided by the dirty digit comparison
+extern uint32_t display_Words_Sent;
+extern uint32_t display_Words_Skipped;
+// LOAD pulses, one per register row no matter the length of the chain
+extern uint32_t display_Rows_Sent;
 
 /* *****************************************************************
  *                       Function prototypes
@@ -163,6 +250,195 @@ void initDisplay(void);
 
 void SpiSend(uint8_t registerAddress, uint8_t registerValue);
 
+/**
+*****************************************************************************
+*
+*  @brief Sends a complete frame of register writes with the selected transport
+*
+*  @param[in]   frame       Words built with DISPLAY_WORD, in rows of
+*                           DISPLAY_CHAIN_LENGTH words. The first word of a
+*                           row goes to the last panel of the chain
+*  @param[in]   length      Number of words, up to DISPLAY_FRAME_MAX_WORDS
+*  @param[in]   callback    Function called once the frame is sent, can be NULL
+*
+*  @b example
+*  @code
+*      bool sent = displaySendFrame(frame, DISPLAY_MAX_LENGTH, NULL);
+*  @endcode
+*
+*  @note
+*      With the SSI transport the function returns right after starting the
+*      uDMA, the frame is copied so the caller can reuse its buffer. Returns
+*      false if the previous frame is still on the wire.
+*
+******************************************************************************
+*/
+
+bool displaySendFrame(const uint16_t* frame, uint8_t length, DisplayFrameCallback callback);
+
+/**
+*****************************************************************************
+*
+*  @brief Indicates if a frame is still being sent
+*
+*  @b example
+*  @code
+*      bool busy = displayFrameBusy();
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+
+bool displayFrameBusy(void);
+
+/**
+*****************************************************************************
+*
+*  @brief Gets the handle of one panel of the chain
+*
+*  @param[in]   position    Position in the chain, 0 is the closest to the micro
+*
+*  @b example
+*  @code
+*      DisplayHandle clockPanel = displayGetPanel(1);
+*  @endcode
+*
+*  @note
+*      Returns NULL if the position is out of the chain
+*
+******************************************************************************
+*/
+
+DisplayHandle displayGetPanel(const uint8_t position);
+
+/**
+*****************************************************************************
+*
+*  @brief Cleans the framebuffer of a panel
+*
+*  @param[in]   panel       Handle of the panel
+*
+*  @b example
+*  @code
+*      void displayPanelClear(panel);
+*  @endcode
+*
+*  @note
+*      Nothing is sent until displayFlush is called
+*
+******************************************************************************
+*/
+
+void displayPanelClear(DisplayHandle panel);
+
+/**
+*****************************************************************************
+*
+*  @brief Sets the segments of one digit in the framebuffer of a panel
+*
+*  @param[in]   panel          Handle of the panel
+*  @param[in]   digitAddress   OP_DIGIT0 to OP_DIGIT7
+*  @param[in]   digitValue     Segments, see SevenDigitMacros.h
+*
+*  @b example
+*  @code
+*      void displayPanelDigit(panel, OP_DIGIT0, SEVEN_DIGIT_DISPLAY_MINUS);
+*  @endcode
+*
+*  @note
+*      Nothing is sent until displayFlush is called
+*
+******************************************************************************
+*/
+
+void displayPanelDigit(DisplayHandle panel, const uint8_t digitAddress, const uint8_t digitValue);
+
+/**
+*****************************************************************************
+*
+*  @brief Renders the temperature value in the framebuffer of a panel
+*
+*  @param[in]   panel       Handle of the panel
+*  @param[in]   tempTenths  Temperature in tenths of degree, 253 shows 25.3
+*
+*  @b example
+*  @code
+*      void displayPanelTempValue(panel, tempTenths);
+*  @endcode
+*
+*  @note
+*      Nothing is sent until displayFlush is called
+*
+******************************************************************************
+*/
+
+void displayPanelTempValue(DisplayHandle panel, const int32_t tempTenths);
+
+/**
+*****************************************************************************
+*
+*  @brief Renders the time in the framebuffer of a panel
+*
+*  @param[in]   panel       Handle of the panel
+*  @param[in]   hours       Hours to be displayed
+*  @param[in]   minutes     Minutes to be displayed
+*
+*  @b example
+*  @code
+*      void displayPanelTime(panel, hours, minutes);
+*  @endcode
+*
+*  @note
+*      Nothing is sent until displayFlush is called
+*
+******************************************************************************
+*/
+
+void displayPanelTime(DisplayHandle panel, const uint8_t hours, const uint8_t minutes);
+
+/**
+*****************************************************************************
+*
+*  @brief Sends to the MAX7219 chain only the digits of the framebuffers that
+*         are different from the ones it already holds
+*
+*  @b example
+*  @code
+*      void displayFlush();
+*  @endcode
+*
+*  @note
+*      displayTempValue and displayTime call it after rendering, there is
+*      no need to clean the display before so it does not flicker.
+*      Every row with a change costs one LOAD pulse for all the chain, the
+*      panels without change in that row receive OP_NOOP
+*
+******************************************************************************
+*/
+
+void displayFlush(void);
+
+/**
+*****************************************************************************
+*
+*  @brief Interrupt routine of SSI2, finishes the frames started by the uDMA
+*
+*  @b example
+*  @code
+*      void displaySsiInterrupt();
+*  @endcode
+*
+*  @note
+*      Must be called from the Hwi of INT_SSI2
+*
+******************************************************************************
+*/
+
+void displaySsiInterrupt(void);
+
 /**
 *****************************************************************************
 *
@@ -179,30 +455,51 @@ void SpiSend(uint8_t registerAddress, uint8_t registerValue);
 ******************************************************************************
 */
 
-static void cleanDisplay(void);
+void cleanDisplay(void);
 
 /**
 *****************************************************************************
 *
 *  @brief Displays the temperature value
 *
-*  @param[in]    tempValue     Temperature value including decimal point
+*  @param[in]    tempTenths    Temperature in tenths of degree, 253 shows 25.3
 *
 *  @b example
 *  @code
-*      void displayTempValue((int)tempValue);
+*      void displayTempValue(tempTenths);
 *  @endcode
 *
 *  @note
-*      The temperature value must be multiplied by 10 as the algorithm
-*      includes the decimal point
+*      The decimal point goes on the units, so no floating point is
+*      needed. Uses the panel 0 of the chain
 *
 ******************************************************************************
 */
 
 
 
-void displayTempValue(const float tempValue);
+void displayTempValue(const int32_t tempTenths);
+
+/**
+*****************************************************************************
+*
+*  @brief Displays the temperature value with a status symbol on the last digit
+*
+*  @param[in]    tempTenths       Temperature in tenths of degree, 253 shows 25.3
+*  @param[in]    statusSegments   Segments of OP_DIGIT7, SEVEN_DIGIT_DISPLAY_BLANK for none
+*
+*  @b example
+*  @code
+*      displayTempValueStatus(tempTenths, SEVEN_DIGIT_DISPLAY_A_LETTER_CL);
+*  @endcode
+*
+*  @note
+*      Same as displayTempValue(), uses the panel 0 of the chain
+*
+******************************************************************************
+*/
+
+void displayTempValueStatus(const int32_t tempTenths, const uint8_t statusSegments);
 
 /**
 *****************************************************************************
@@ -218,7 +515,7 @@ void displayTempValue(const float tempValue);
 *  @endcode
 *
 *  @note
-*      n/a
+*      Uses the panel 0 of the chain
 *
 ******************************************************************************
 */
@@ -0,0 +1,97 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    DisplayTables.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a source file for C language. The purpose is to
+    keep the precomputed segment tables of the display.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The tables are expanded by the preprocessor from the entry macros of
+    DisplayTables.h. The temperature table uses 2.5 KB of flash, the clock
+    tables less than 200 bytes.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "DisplayTables.h"
+
+const uint8_t displayTempTable[DISPLAY_TEMP_TABLE_SIZE][DISPLAY_TEMP_TABLE_DIGITS] =
+{
+    // 0.0 to 79.9
+    DISPLAY_TABLE_REPEAT_100(DISPLAY_TEMP_TABLE_ENTRY, 0)
+    DISPLAY_TABLE_REPEAT_100(DISPLAY_TEMP_TABLE_ENTRY, 100)
+    DISPLAY_TABLE_REPEAT_100(DISPLAY_TEMP_TABLE_ENTRY, 200)
+    DISPLAY_TABLE_REPEAT_100(DISPLAY_TEMP_TABLE_ENTRY, 300)
+    DISPLAY_TABLE_REPEAT_100(DISPLAY_TEMP_TABLE_ENTRY, 400)
+    DISPLAY_TABLE_REPEAT_100(DISPLAY_TEMP_TABLE_ENTRY, 500)
+    DISPLAY_TABLE_REPEAT_100(DISPLAY_TEMP_TABLE_ENTRY, 600)
+    DISPLAY_TABLE_REPEAT_100(DISPLAY_TEMP_TABLE_ENTRY, 700)
+    // 80.0 to 85.0
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_TEMP_TABLE_ENTRY, 800)
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_TEMP_TABLE_ENTRY, 810)
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_TEMP_TABLE_ENTRY, 820)
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_TEMP_TABLE_ENTRY, 830)
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_TEMP_TABLE_ENTRY, 840)
+    DISPLAY_TEMP_TABLE_ENTRY(850)
+};
+
+const uint8_t displayMinutesTable[DISPLAY_MINUTES_TABLE_SIZE][2] =
+{
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_MINUTES_TABLE_ENTRY, 0)
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_MINUTES_TABLE_ENTRY, 10)
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_MINUTES_TABLE_ENTRY, 20)
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_MINUTES_TABLE_ENTRY, 30)
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_MINUTES_TABLE_ENTRY, 40)
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_MINUTES_TABLE_ENTRY, 50)
+};
+
+const uint8_t displayHoursTable[DISPLAY_HOURS_TABLE_SIZE][DISPLAY_HOURS_FIELDS] =
+{
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_HOURS_TABLE_ENTRY, 0)
+    DISPLAY_TABLE_REPEAT_10(DISPLAY_HOURS_TABLE_ENTRY, 10)
+    DISPLAY_HOURS_TABLE_ENTRY(20)
+    DISPLAY_HOURS_TABLE_ENTRY(21)
+    DISPLAY_HOURS_TABLE_ENTRY(22)
+    DISPLAY_HOURS_TABLE_ENTRY(23)
+};
+
+// End of file
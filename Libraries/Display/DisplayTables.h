@@ -0,0 +1,143 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    DisplayTables.h
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a header file for C language. The purpose is to
+    declare the precomputed segment tables of the display.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Every value the display can show (temperature between -40.0 and 85.0,
+    hours and minutes) has its segments already calculated. The tables are
+    generated by the preprocessor with the macros of this file, so there is
+    no external tool and they are always in sync with SevenDigitMacros.h.
+    Being const they are placed in flash.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#ifndef LIBRARIES_DISPLAY_DISPLAYTABLES_H_
+#define LIBRARIES_DISPLAY_DISPLAYTABLES_H_
+
+/* *****************************************************************
+ *                        Included files
+ * *****************************************************************
+ */
+#include <stdint.h>
+#include "SevenDigitMacros.h"
+
+/* *****************************************************************
+ *                        Macros
+ * *****************************************************************
+ */
+
+// Biggest magnitude in tenths of degree, compensateTemperature clamps to 85.0
+#define DISPLAY_TEMP_TABLE_MAX_TENTHS 850
+#define DISPLAY_TEMP_TABLE_SIZE       (DISPLAY_TEMP_TABLE_MAX_TENTHS + 1)
+// Digits 2, 3 & 4 of the display, the sign goes on the first blank one
+#define DISPLAY_TEMP_TABLE_DIGITS     3
+// Values below 10.0 use only two digits
+#define DISPLAY_TEMP_TWO_DIGITS_LIMIT 100
+
+#define DISPLAY_HOURS_TABLE_SIZE      24
+#define DISPLAY_MINUTES_TABLE_SIZE    60
+
+// Hours above 12 are shown in 12h format with the degree symbol as PM
+#define DISPLAY_HOURS_PM_LIMIT        13
+
+// Expands a macro for every value of a range, used to generate the tables
+#define DISPLAY_TABLE_REPEAT_10(entry, base)  \
+    entry((base) + 0) entry((base) + 1) entry((base) + 2) entry((base) + 3) entry((base) + 4) \
+    entry((base) + 5) entry((base) + 6) entry((base) + 7) entry((base) + 8) entry((base) + 9)
+
+#define DISPLAY_TABLE_REPEAT_100(entry, base) \
+    DISPLAY_TABLE_REPEAT_10(entry, (base) + 0)  DISPLAY_TABLE_REPEAT_10(entry, (base) + 10) \
+    DISPLAY_TABLE_REPEAT_10(entry, (base) + 20) DISPLAY_TABLE_REPEAT_10(entry, (base) + 30) \
+    DISPLAY_TABLE_REPEAT_10(entry, (base) + 40) DISPLAY_TABLE_REPEAT_10(entry, (base) + 50) \
+    DISPLAY_TABLE_REPEAT_10(entry, (base) + 60) DISPLAY_TABLE_REPEAT_10(entry, (base) + 70) \
+    DISPLAY_TABLE_REPEAT_10(entry, (base) + 80) DISPLAY_TABLE_REPEAT_10(entry, (base) + 90)
+
+// Tenths with the decimal point on the units, same as displayTempValue
+#define DISPLAY_TEMP_TABLE_ENTRY(tenths) \
+    { SEVEN_DIGIT_SEGMENTS((tenths) % 10), \
+      SEVEN_DIGIT_SEGMENTS((tenths) / 10 % 10) | SEVEN_DIGIT_DISPLAY_POINT, \
+      (tenths) >= DISPLAY_TEMP_TWO_DIGITS_LIMIT ? SEVEN_DIGIT_SEGMENTS((tenths) / 100 % 10) : SEVEN_DIGIT_DISPLAY_BLANK },
+
+// Units and tens of the minutes
+#define DISPLAY_MINUTES_TABLE_ENTRY(minutes) \
+    { SEVEN_DIGIT_SEGMENTS((minutes) % 10), SEVEN_DIGIT_SEGMENTS((minutes) / 10) },
+
+// Hour in 12h format, units with point, tens only when not 0 and the PM symbol
+#define DISPLAY_HOUR_12H(hours) ((hours) < DISPLAY_HOURS_PM_LIMIT ? (hours) : (hours) - 12)
+#define DISPLAY_HOURS_TABLE_ENTRY(hours) \
+    { SEVEN_DIGIT_SEGMENTS(DISPLAY_HOUR_12H(hours) % 10) | SEVEN_DIGIT_DISPLAY_POINT, \
+      DISPLAY_HOUR_12H(hours) >= 10 ? SEVEN_DIGIT_SEGMENTS(DISPLAY_HOUR_12H(hours) / 10) : SEVEN_DIGIT_DISPLAY_BLANK, \
+      (hours) < DISPLAY_HOURS_PM_LIMIT ? SEVEN_DIGIT_DISPLAY_BLANK : SEVEN_DIGIT_DISPLAY_DEGREE },
+
+/* *****************************************************************
+ *                        Definitions
+ * *****************************************************************
+ */
+
+// Position of every byte in the hours table
+enum DisplayHoursTableField
+{
+    DISPLAY_HOURS_UNITS = 0,
+    DISPLAY_HOURS_TENS,
+    DISPLAY_HOURS_PM,
+    DISPLAY_HOURS_FIELDS
+};
+
+/* *****************************************************************
+ *                       Global variables
+ * *****************************************************************
+ */
+
+// Segments of the digits 2, 3 & 4 for every magnitude in tenths of degree
+extern const uint8_t displayTempTable[DISPLAY_TEMP_TABLE_SIZE][DISPLAY_TEMP_TABLE_DIGITS];
+
+// Segments of the units and tens of every minute
+extern const uint8_t displayMinutesTable[DISPLAY_MINUTES_TABLE_SIZE][2];
+
+// Segments of the units, tens and PM symbol of every hour
+extern const uint8_t displayHoursTable[DISPLAY_HOURS_TABLE_SIZE][DISPLAY_HOURS_FIELDS];
+
+#endif /* LIBRARIES_DISPLAY_DISPLAYTABLES_H_ */
@@ -68,23 +68,47 @@
  */
 
 // Numbers
-static const uint8_t sevenDigitDisplayMatrix[] = {0b01111110,  // Number 0
-                                                  0b00110000,  // Number 1
-                                                  0b01101101,  // Number 2
-                                                  0b01111001,  // Number 3
-                                                  0b00110011,  // Number 4
-                                                  0b01011011,  // Number 5
-                                                  0b01011111,  // Number 6
-                                                  0b01110000,  // Number 7
-                                                  0b01111111,  // Number 8
-                                                  0b01110011}; // Number 9
+#define SEVEN_DIGIT_DISPLAY_NUMBER_0  (uint8_t)0b01111110
+#define SEVEN_DIGIT_DISPLAY_NUMBER_1  (uint8_t)0b00110000
+#define SEVEN_DIGIT_DISPLAY_NUMBER_2  (uint8_t)0b01101101
+#define SEVEN_DIGIT_DISPLAY_NUMBER_3  (uint8_t)0b01111001
+#define SEVEN_DIGIT_DISPLAY_NUMBER_4  (uint8_t)0b00110011
+#define SEVEN_DIGIT_DISPLAY_NUMBER_5  (uint8_t)0b01011011
+#define SEVEN_DIGIT_DISPLAY_NUMBER_6  (uint8_t)0b01011111
+#define SEVEN_DIGIT_DISPLAY_NUMBER_7  (uint8_t)0b01110000
+#define SEVEN_DIGIT_DISPLAY_NUMBER_8  (uint8_t)0b01111111
+#define SEVEN_DIGIT_DISPLAY_NUMBER_9  (uint8_t)0b01110011
+
+static const uint8_t sevenDigitDisplayMatrix[] = {SEVEN_DIGIT_DISPLAY_NUMBER_0,
+                                                  SEVEN_DIGIT_DISPLAY_NUMBER_1,
+                                                  SEVEN_DIGIT_DISPLAY_NUMBER_2,
+                                                  SEVEN_DIGIT_DISPLAY_NUMBER_3,
+                                                  SEVEN_DIGIT_DISPLAY_NUMBER_4,
+                                                  SEVEN_DIGIT_DISPLAY_NUMBER_5,
+                                                  SEVEN_DIGIT_DISPLAY_NUMBER_6,
+                                                  SEVEN_DIGIT_DISPLAY_NUMBER_7,
+                                                  SEVEN_DIGIT_DISPLAY_NUMBER_8,
+                                                  SEVEN_DIGIT_DISPLAY_NUMBER_9};
+
+// Same numbers as a constant expression, to build tables at compile time
+#define SEVEN_DIGIT_SEGMENTS(digit) (uint8_t)( \
+    (digit) == 0 ? SEVEN_DIGIT_DISPLAY_NUMBER_0 : (digit) == 1 ? SEVEN_DIGIT_DISPLAY_NUMBER_1 : \
+    (digit) == 2 ? SEVEN_DIGIT_DISPLAY_NUMBER_2 : (digit) == 3 ? SEVEN_DIGIT_DISPLAY_NUMBER_3 : \
+    (digit) == 4 ? SEVEN_DIGIT_DISPLAY_NUMBER_4 : (digit) == 5 ? SEVEN_DIGIT_DISPLAY_NUMBER_5 : \
+    (digit) == 6 ? SEVEN_DIGIT_DISPLAY_NUMBER_6 : (digit) == 7 ? SEVEN_DIGIT_DISPLAY_NUMBER_7 : \
+    (digit) == 8 ? SEVEN_DIGIT_DISPLAY_NUMBER_8 : SEVEN_DIGIT_DISPLAY_NUMBER_9)
 
 //Letters
 #define SEVEN_DIGIT_DISPLAY_C_LETTER_CL (uint8_t)0b01001110 // C
 #define SEVEN_DIGIT_DISPLAY_H_LETTER_LC (uint8_t)0b00010111 // h
+#define SEVEN_DIGIT_DISPLAY_A_LETTER_CL (uint8_t)0b01110111 // A
+#define SEVEN_DIGIT_DISPLAY_L_LETTER_CL (uint8_t)0b00001110 // L
+#define SEVEN_DIGIT_DISPLAY_S_LETTER_CL (uint8_t)0b01011011 // S
 
 //Symbols
 #define SEVEN_DIGIT_DISPLAY_DEGREE    (uint8_t)0b01100011
 #define SEVEN_DIGIT_DISPLAY_MINUS     (uint8_t)0b00000001
+#define SEVEN_DIGIT_DISPLAY_POINT     (uint8_t)0b10000000
+#define SEVEN_DIGIT_DISPLAY_BLANK     (uint8_t)0b00000000
 
 #endif /* LIBRARIES_SEVENDIGITMACROS_H_ */
@@ -0,0 +1,177 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Filter.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a source file for C language. The purpose is to
+    filter the temperature samples with integer math only.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The stages run inside the I2C2 interrupt, so none of them uses floating
+    point or loops over more than FILTER_CIC_MAX_ORDER values per sample.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "Filter.h"
+
+// state[0] is the output scaled by 2^shift, the first sample fills it directly
+static bool filterEma(FilterStage* stage, int32_t* sample)
+{
+    uint8_t shift = stage->parameter;
+
+    if(shift > FILTER_EMA_MAX_SHIFT) { shift = FILTER_EMA_MAX_SHIFT; }
+
+    if(stage->count == 0)
+    {
+        stage->state[0] = *sample * (1 << shift);
+        stage->count    = 1;
+    }
+    else
+    {
+        // Rounded like the output, a truncated one settles 1 above a falling step
+        stage->state[0] += *sample - ((stage->state[0] + ((1 << shift) >> 1)) >> shift);
+    }
+    *sample = (stage->state[0] + ((1 << shift) >> 1)) >> shift;
+
+    return true;
+}
+
+// Integrators in state[0..N-1] at the input rate, combs in state[N..2N-1] at the output rate
+static bool filterCic(FilterStage* stage, int32_t* sample)
+{
+    uint8_t  order      = stage->order;
+    uint8_t  decimation = stage->parameter;
+    uint8_t  index;
+    uint32_t value      = (uint32_t)*sample;
+    uint32_t delayed;
+    int32_t  gain       = 1;
+
+    if(order == 0) { order = 1; }
+    else if(order > FILTER_CIC_MAX_ORDER) { order = FILTER_CIC_MAX_ORDER; }
+    if(decimation == 0) { decimation = 1; }
+    else if(decimation > FILTER_CIC_MAX_DECIMATION) { decimation = FILTER_CIC_MAX_DECIMATION; }
+
+    // Unsigned wrap of the integrators is cancelled by the combs
+    for(index = 0; index < order; index++)
+    {
+        stage->state[index] = (int32_t)((uint32_t)stage->state[index] + value);
+        value = (uint32_t)stage->state[index];
+    }
+
+    stage->count++;
+    if(stage->count < decimation) { return false; }
+    stage->count = 0;
+
+    for(index = 0; index < order; index++)
+    {
+        delayed = (uint32_t)stage->state[order + index];
+        stage->state[order + index] = (int32_t)value;
+        value  -= delayed;
+        gain   *= decimation;
+    }
+    *sample = (int32_t)value / gain;
+
+    return true;
+}
+
+void filterReset(FilterStage* stages, uint8_t count)
+{
+    uint8_t stage;
+    uint8_t index;
+
+    for(stage = 0; stage < count; stage++)
+    {
+        stages[stage].count = 0;
+        for(index = 0; index < FILTER_STATE_LENGTH; index++)
+        {
+            stages[stage].state[index] = 0;
+        }
+        stages[stage].cycles.lastCycles = 0;
+        stages[stage].cycles.maxCycles  = 0;
+        stages[stage].cycles.samples    = 0;
+    }
+}
+
+bool filterProcess(FilterStage* stages, uint8_t count, int32_t* sample)
+{
+    uint8_t stage;
+    bool    output = true;
+    int32_t value  = *sample;
+
+    for(stage = 0; stage < count && output; stage++)
+    {
+        profilingStart(&stages[stage].cycles);
+        switch(stages[stage].type)
+        {
+        case filter_Ema:
+            output = filterEma(&stages[stage], &value);
+            break;
+        case filter_Cic:
+            output = filterCic(&stages[stage], &value);
+            break;
+        // The sensor filters before the conversion is read, nothing to do here
+        case filter_Sensor_Iir:
+        case filter_None:
+        default:
+            break;
+        }
+        profilingStop(&stages[stage].cycles);
+    }
+
+    if(output) { *sample = value; }
+
+    return output;
+}
+
+uint8_t filterSensorIir(const FilterStage* stages, uint8_t count)
+{
+    uint8_t stage;
+
+    for(stage = 0; stage < count; stage++)
+    {
+        if(stages[stage].type == filter_Sensor_Iir) { return stages[stage].parameter; }
+    }
+
+    return 0;
+}
+
+// End of file
@@ -0,0 +1,176 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Filter.h
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a header file for C language. The purpose is to
+    give a chain of integer filters for the temperature samples.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    A chain is an array of stages, every stage has its own integer state
+    and its own cycle counter. A sample goes through the stages in order,
+    a decimating stage can keep it and give no output for that sample.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#ifndef LIBRARIES_FILTER_FILTER_H_
+#define LIBRARIES_FILTER_FILTER_H_
+
+/* *****************************************************************
+ *                        Included files
+ * *****************************************************************
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "../Profiling/Profiling.h"
+
+/* *****************************************************************
+ *                        Macros
+ * *****************************************************************
+ */
+
+#define FILTER_MAX_STAGES      4
+
+// Integrators and combs of the CIC, or the accumulator of the EMA
+#define FILTER_CIC_MAX_ORDER   3
+#define FILTER_STATE_LENGTH    (2 * FILTER_CIC_MAX_ORDER)
+
+// EMA weight is 1 / 2^shift
+#define FILTER_EMA_MAX_SHIFT   8
+
+// Keeps R^N of the CIC inside 32 bits with 14 bit samples
+#define FILTER_CIC_MAX_DECIMATION 16
+
+/* *****************************************************************
+ *                        Definitions
+ * *****************************************************************
+ */
+
+typedef enum
+{
+    filter_None       ,
+    filter_Ema        ,
+    filter_Cic        ,
+    filter_Sensor_Iir
+}FilterType;
+
+// parameter is the EMA shift, the CIC decimation or the IIR_* code of the sensor
+typedef struct
+{
+    FilterType       type;
+    uint8_t          parameter;
+    uint8_t          order;
+    uint8_t          count;
+    int32_t          state[FILTER_STATE_LENGTH];
+    ProfilingCounter cycles;
+}FilterStage;
+
+/* *****************************************************************
+ *                       Function prototypes
+ * *****************************************************************
+ */
+
+/**
+*****************************************************************************
+*
+*  @brief Clears the state and the cycle counters of the stages
+*
+*  @param[in]   stages      First stage of the chain
+*  @param[in]   count       Number of stages
+*
+*  @b example
+*  @code
+*      filterReset(sensor_Filters, sensor_Filter_Count);
+*  @endcode
+*
+*  @note
+*      Type, parameter and order are kept
+*
+******************************************************************************
+*/
+
+void filterReset(FilterStage* stages, uint8_t count);
+
+/**
+*****************************************************************************
+*
+*  @brief Passes one sample through all the stages of the chain
+*
+*  @param[in]       stages      First stage of the chain
+*  @param[in]       count       Number of stages
+*  @param[in,out]   sample      Input sample, replaced by the output of the chain
+*
+*  @b example
+*  @code
+*      if(filterProcess(sensor_Filters, sensor_Filter_Count, &temperature)) { ... }
+*  @endcode
+*
+*  @note
+*      Returns false when a decimating stage kept the sample, sample is not changed then
+*
+******************************************************************************
+*/
+
+bool filterProcess(FilterStage* stages, uint8_t count, int32_t* sample);
+
+/**
+*****************************************************************************
+*
+*  @brief Gets the IIR_* code of the sensor stage of the chain
+*
+*  @param[in]   stages      First stage of the chain
+*  @param[in]   count       Number of stages
+*
+*  @b example
+*  @code
+*      uint8_t filter = filterSensorIir(sensor_Filters, sensor_Filter_Count);
+*  @endcode
+*
+*  @note
+*      Returns 0 (IIR off) when the chain has no filter_Sensor_Iir stage
+*
+******************************************************************************
+*/
+
+uint8_t filterSensorIir(const FilterStage* stages, uint8_t count);
+
+#endif /* LIBRARIES_FILTER_FILTER_H_ */
@@ -0,0 +1,156 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Format.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to write numbers as
+    text without divisions digit by digit.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    This source file is going to convert the numbers for the UART and the
+    display, with defines in header Format.h.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "Format.h"
+
+// "00" to "99", a division by 100 gives two characters at once
+static const char format_Digit_Pairs[200] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static uint8_t formatDigitCount(uint32_t value)
+{
+    if(value < 10)          { return 1; }
+    if(value < 100)         { return 2; }
+    if(value < 1000)        { return 3; }
+    if(value < 10000)       { return 4; }
+    if(value < 100000)      { return 5; }
+    if(value < 1000000)     { return 6; }
+    if(value < 10000000)    { return 7; }
+    if(value < 100000000)   { return 8; }
+    if(value < 1000000000)  { return 9; }
+    return 10;
+}
+
+uint8_t formatUnsigned(char* text, uint32_t value)
+{
+    uint8_t  length = formatDigitCount(value);
+    char*    digit  = text + length;
+    uint32_t pair;
+
+    // From the last digit to the first, the division by a constant is a multiplication
+    while(value >= 100)
+    {
+        pair    = (value % 100) * 2;
+        value  /= 100;
+        *--digit = format_Digit_Pairs[pair + 1];
+        *--digit = format_Digit_Pairs[pair];
+    }
+    if(value >= 10)
+    {
+        *--digit = format_Digit_Pairs[value * 2 + 1];
+        *--digit = format_Digit_Pairs[value * 2];
+    }
+    else
+    {
+        *--digit = (char)('0' + value);
+    }
+    return length;
+}
+
+uint8_t formatInteger(char* text, int32_t value)
+{
+    if(value < 0)
+    {
+        *text = FORMAT_MINUS_CHAR;
+        // Unsigned negation, INT32_MIN has no positive value
+        return 1 + formatUnsigned(text + 1, 0U - (uint32_t)value);
+    }
+    return formatUnsigned(text, (uint32_t)value);
+}
+
+uint8_t formatFixed(char* text, int32_t value, uint8_t decimals)
+{
+    uint8_t  length    = 0;
+    uint32_t magnitude = (uint32_t)value;
+    uint32_t fraction;
+
+    if(value < 0)
+    {
+        text[length++] = FORMAT_MINUS_CHAR;
+        magnitude = 0U - (uint32_t)value;
+    }
+    if(decimals == FORMAT_HUNDREDTHS)
+    {
+        fraction  = magnitude % 100;
+        length   += formatUnsigned(&text[length], magnitude / 100);
+        text[length++] = FORMAT_POINT_CHAR;
+        text[length++] = format_Digit_Pairs[fraction * 2];
+        text[length++] = format_Digit_Pairs[fraction * 2 + 1];
+    }
+    else
+    {
+        fraction  = magnitude % 10;
+        length   += formatUnsigned(&text[length], magnitude / 10);
+        text[length++] = FORMAT_POINT_CHAR;
+        text[length++] = (char)('0' + fraction);
+    }
+    return length;
+}
+
+uint8_t formatText(char* text, const char* source, uint8_t maxLength)
+{
+    uint8_t length = 0;
+
+    while(source[length] != 0 && length < maxLength)
+    {
+        text[length] = source[length];
+        length++;
+    }
+    return length;
+}
+
+// End of file
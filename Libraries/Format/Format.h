@@ -0,0 +1,182 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Format.h
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a header file for C language. The purpose is to
+    write numbers as text for the UART and the display.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Every function writes to a buffer of the caller and returns the number of
+    characters, so a whole record is built in place and sent at once. The
+    digits are written two at a time from a table of pairs, without a
+    terminating NUL and without memory allocation.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#ifndef LIBRARIES_FORMAT_FORMAT_H_
+#define LIBRARIES_FORMAT_FORMAT_H_
+
+/* *****************************************************************
+ *                        Included files
+ * *****************************************************************
+ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* *****************************************************************
+ *                        Macros
+ * *****************************************************************
+ */
+
+// Longest text of every function, the caller buffer must have room for it
+#define FORMAT_UNSIGNED_MAX_LENGTH  10
+#define FORMAT_INTEGER_MAX_LENGTH   11
+#define FORMAT_FIXED_MAX_LENGTH     12
+
+// Decimals of formatFixed, the value comes multiplied by 10 or by 100
+#define FORMAT_TENTHS               1
+#define FORMAT_HUNDREDTHS           2
+
+#define FORMAT_MINUS_CHAR           '-'
+#define FORMAT_POINT_CHAR           '.'
+
+/* *****************************************************************
+ *                       Function prototypes
+ * *****************************************************************
+ */
+
+/**
+*****************************************************************************
+*
+*  @brief Writes an unsigned value in decimal
+*
+*  @param[out]  text        Destination, FORMAT_UNSIGNED_MAX_LENGTH characters
+*  @param[in]   value       Value to be written
+*
+*  @return      Number of characters written
+*
+*  @b example
+*  @code
+*      lineLength += formatUnsigned(&line[lineLength], labelNumber);
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+
+uint8_t formatUnsigned(char* text, uint32_t value);
+
+/**
+*****************************************************************************
+*
+*  @brief Writes a signed value in decimal
+*
+*  @param[out]  text        Destination, FORMAT_INTEGER_MAX_LENGTH characters
+*  @param[in]   value       Value to be written
+*
+*  @return      Number of characters written
+*
+*  @b example
+*  @code
+*      lineLength += formatInteger(&line[lineLength], adc_Die_Temperature);
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+
+uint8_t formatInteger(char* text, int32_t value);
+
+/**
+*****************************************************************************
+*
+*  @brief Writes a fixed point value with its decimal point
+*
+*  @param[out]  text        Destination, FORMAT_FIXED_MAX_LENGTH characters
+*  @param[in]   value       Value multiplied by 10 or by 100
+*  @param[in]   decimals    FORMAT_TENTHS or FORMAT_HUNDREDTHS
+*
+*  @return      Number of characters written
+*
+*  @b example
+*  @code
+*      lineLength += formatFixed(&line[lineLength], sensor_Temperature, FORMAT_HUNDREDTHS);
+*  @endcode
+*
+*  @note
+*      There is always a digit before the point, -5 in tenths is written -0.5
+*
+******************************************************************************
+*/
+
+uint8_t formatFixed(char* text, int32_t value, uint8_t decimals);
+
+/**
+*****************************************************************************
+*
+*  @brief Copies a NUL terminated text without its NUL
+*
+*  @param[out]  text        Destination
+*  @param[in]   source      Text to be copied
+*  @param[in]   maxLength   Characters that fit in the destination
+*
+*  @return      Number of characters written
+*
+*  @b example
+*  @code
+*      lineLength += formatText(&line[lineLength], TEMPERATURE_MID_LABEL, sizeof(line) - lineLength);
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+
+uint8_t formatText(char* text, const char* source, uint8_t maxLength);
+
+#endif /* LIBRARIES_FORMAT_FORMAT_H_ */
@@ -0,0 +1,311 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    I2cEngine.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a source file for C language. The purpose is to
+    run the queue of I2C transactions of every I2C module.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Writes are sent one byte per interrupt. Reads use the RX FIFO of the
+    master with one burst, the interrupt or the uDMA empties the FIFO and
+    the stop condition ends the transaction.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "I2cEngine.h"
+
+// Events of the last transaction that were not enabled, like the data of a stop, would start the next one
+static void i2cClearStatus(I2cEngine* engine)
+{
+    I2CMasterIntClearEx(engine->base, I2CMasterIntStatusEx(engine->base, false));
+}
+
+// Starts the read of the current transaction, with a repeated start after a write
+static void i2cStartRead(I2cEngine* engine)
+{
+    I2cTransaction* transaction = engine->current;
+
+    engine->phase      = i2c_Phase_Read;
+    engine->dmaDone    = false;
+    engine->stopSent   = false;
+    transaction->count = 0;
+    i2cClearStatus(engine);
+    if(engine->dmaChannel != I2C_ENGINE_NO_DMA)
+    {
+        uDMAChannelTransferSet(engine->dmaChannel | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                               (void *)(engine->base + I2C_O_FIFODATA), transaction->readData, transaction->readLength);
+        uDMAChannelEnable(engine->dmaChannel);
+        I2CMasterIntDisableEx(engine->base, I2C_ENGINE_INTERRUPTS);
+        I2CMasterIntEnableEx(engine->base, I2C_DMA_READ_INTERRUPTS);
+    }
+    else
+    {
+        I2CMasterIntDisableEx(engine->base, I2C_ENGINE_INTERRUPTS);
+        I2CMasterIntEnableEx(engine->base, I2C_READ_INTERRUPTS);
+    }
+    I2CMasterSlaveAddrSet(engine->base, transaction->address, true);
+    I2CMasterBurstLengthSet(engine->base, transaction->readLength);
+    I2CMasterControl(engine->base, I2C_MASTER_CMD_FIFO_SINGLE_RECEIVE);
+}
+
+// Starts the oldest transaction of the queue, interrupts must be disabled
+static void i2cStartNext(I2cEngine* engine)
+{
+    I2cTransaction* transaction;
+
+    if(engine->current != NULL || engine->head == engine->tail) { return; }
+
+    transaction     = engine->queue[engine->tail & I2C_QUEUE_MASK];
+    engine->current = transaction;
+
+    if(transaction->writeLength == 0)
+    {
+        i2cStartRead(engine);
+        return;
+    }
+
+    engine->phase      = i2c_Phase_Write;
+    transaction->count = 1;
+    i2cClearStatus(engine);
+    I2CMasterIntDisableEx(engine->base, I2C_ENGINE_INTERRUPTS);
+    I2CMasterIntEnableEx(engine->base, I2C_WRITE_INTERRUPTS);
+    I2CMasterSlaveAddrSet(engine->base, transaction->address, false);
+    I2CMasterDataPut(engine->base, transaction->writeData[0]);
+    // Without a read the only byte also ends with the stop condition
+    if(transaction->writeLength == 1 && transaction->readLength == 0)
+    {
+        I2CMasterControl(engine->base, I2C_MASTER_CMD_SINGLE_SEND);
+    }
+    else
+    {
+        I2CMasterControl(engine->base, I2C_MASTER_CMD_BURST_SEND_START);
+    }
+}
+
+// Ends the current transaction, its callback can already queue the next one
+static void i2cFinish(I2cEngine* engine, I2cStatus status)
+{
+    I2cTransaction* transaction = engine->current;
+    bool            disabled;
+
+    disabled        = IntMasterDisable();
+    engine->current = NULL;
+    engine->phase   = i2c_Phase_Idle;
+    engine->tail++;
+    engine->transactions++;
+    if(!disabled) { IntMasterEnable(); }
+
+    transaction->status = status;
+    if(transaction->callback != NULL) { transaction->callback(transaction); }
+
+    disabled = IntMasterDisable();
+    i2cStartNext(engine);
+    if(!disabled) { IntMasterEnable(); }
+}
+
+// Ends the current transaction after an error, a burst without stop must be closed by the master
+static void i2cFail(I2cEngine* engine, I2cStatus status)
+{
+    I2cTransaction* transaction = engine->current;
+
+    if(status == i2c_Status_Nack && engine->phase == i2c_Phase_Write &&
+       (transaction->writeLength > 1 || transaction->readLength > 0))
+    {
+        I2CMasterControl(engine->base, I2C_MASTER_CMD_BURST_SEND_ERROR_STOP);
+    }
+    if(engine->dmaChannel != I2C_ENGINE_NO_DMA) { uDMAChannelDisable(engine->dmaChannel); }
+    I2CRxFIFOFlush(engine->base);
+    engine->errors++;
+    i2cFinish(engine, status);
+}
+
+void i2cEngineInit(I2cEngine* engine, uint32_t base, uint32_t interrupt, uint32_t clock)
+{
+    engine->base         = base;
+    engine->head         = 0;
+    engine->tail         = 0;
+    engine->current      = NULL;
+    engine->phase        = i2c_Phase_Idle;
+    engine->dmaChannel   = I2C_ENGINE_NO_DMA;
+    engine->dmaDone      = false;
+    engine->stopSent     = false;
+    engine->transactions = 0;
+    engine->errors       = 0;
+
+    I2CMasterInitExpClk(base, clock, true);
+    I2CMasterTimeoutSet(base, I2C_CLOCK_LOW_TIMEOUT);
+    // Half full RX FIFO interrupts the CPU during long reads
+    I2CRxFIFOConfigSet(base, I2C_FIFO_CFG_RX_MASTER | I2C_FIFO_CFG_RX_TRIG_4);
+    I2CRxFIFOFlush(base);
+    I2CMasterIntEnableEx(base, I2C_ENGINE_INTERRUPTS);
+    IntEnable(interrupt);
+    while(I2CMasterBusBusy(base));
+}
+
+void i2cEngineEnableDma(I2cEngine* engine, uint32_t channel)
+{
+    uDMAChannelAssign(channel);
+    uDMAChannelAttributeDisable(channel, UDMA_ATTR_ALL);
+    // Bytes from the FIFO register to the buffer, 4 per request like the FIFO trigger
+    uDMAChannelControlSet(channel | UDMA_PRI_SELECT, UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 | UDMA_ARB_4);
+    I2CRxFIFOConfigSet(engine->base, I2C_FIFO_CFG_RX_MASTER_DMA | I2C_FIFO_CFG_RX_TRIG_4);
+    I2CRxFIFOFlush(engine->base);
+    engine->dmaChannel = channel;
+}
+
+void i2cTransactionInit(I2cTransaction* transaction, uint8_t address, const uint8_t* writeData, uint8_t writeLength,
+                        uint8_t* readData, uint8_t readLength, I2cCallback callback, void* context)
+{
+    transaction->address     = address;
+    transaction->writeData   = writeData;
+    transaction->writeLength = writeLength;
+    transaction->readData    = readData;
+    transaction->readLength  = readLength;
+    transaction->callback    = callback;
+    transaction->context     = context;
+    transaction->status      = i2c_Status_Done;
+    transaction->count       = 0;
+}
+
+bool i2cSubmit(I2cEngine* engine, I2cTransaction* transaction)
+{
+    bool disabled = IntMasterDisable();
+    bool queued   = false;
+
+    if((uint8_t)(engine->head - engine->tail) < I2C_QUEUE_LENGTH)
+    {
+        transaction->status = i2c_Status_Pending;
+        engine->queue[engine->head & I2C_QUEUE_MASK] = transaction;
+        engine->head++;
+        queued = true;
+        i2cStartNext(engine);
+    }
+
+    if(!disabled) { IntMasterEnable(); }
+
+    return queued;
+}
+
+void i2cEngineInterrupt(I2cEngine* engine)
+{
+    uint32_t        status      = I2CMasterIntStatusEx(engine->base, true);
+    I2cTransaction* transaction = engine->current;
+    uint8_t         data;
+
+    I2CMasterIntClearEx(engine->base, status);
+
+    if(transaction == NULL) { return; }
+
+    // The bus is released by the module after a timeout or a lost arbitration
+    if(status & (I2C_MASTER_INT_TIMEOUT | I2C_MASTER_INT_ARB_LOST))
+    {
+        i2cFail(engine, i2c_Status_Bus_Error);
+        return;
+    }
+    if(status & I2C_MASTER_INT_NACK)
+    {
+        i2cFail(engine, i2c_Status_Nack);
+        return;
+    }
+
+    if(engine->phase == i2c_Phase_Write)
+    {
+        // One byte per data interrupt, other events of the write are ignored
+        if(!(status & I2C_MASTER_INT_DATA)) { return; }
+
+        if(transaction->count < transaction->writeLength)
+        {
+            I2CMasterDataPut(engine->base, transaction->writeData[transaction->count++]);
+            if(transaction->count == transaction->writeLength && transaction->readLength == 0)
+            {
+                I2CMasterControl(engine->base, I2C_MASTER_CMD_BURST_SEND_FINISH);
+            }
+            else
+            {
+                I2CMasterControl(engine->base, I2C_MASTER_CMD_BURST_SEND_CONT);
+            }
+        }
+        else if(transaction->readLength > 0) { i2cStartRead(engine); }
+        else { i2cFinish(engine, i2c_Status_Done); }
+    }
+    else if(engine->phase == i2c_Phase_Read && engine->dmaChannel != I2C_ENGINE_NO_DMA)
+    {
+        // The uDMA done of the last byte and the stop can come in any order, both end the read
+        if(status & I2C_MASTER_INT_RX_DMA_DONE) { engine->dmaDone  = true; }
+        if(status & I2C_MASTER_INT_STOP)        { engine->stopSent = true; }
+        if(engine->dmaDone && engine->stopSent)
+        {
+            transaction->count = transaction->readLength;
+            i2cFinish(engine, i2c_Status_Done);
+        }
+    }
+    else if(engine->phase == i2c_Phase_Read)
+    {
+        while(I2CFIFODataGetNonBlocking(engine->base, &data))
+        {
+            if(transaction->count < transaction->readLength)
+            {
+                transaction->readData[transaction->count++] = data;
+            }
+        }
+        // The stop comes after the last byte, the count only guards a short read
+        if((status & I2C_MASTER_INT_STOP) && transaction->count == transaction->readLength)
+        {
+            i2cFinish(engine, i2c_Status_Done);
+        }
+    }
+}
+
+bool i2cEngineIdle(I2cEngine* engine)
+{
+    return engine->current == NULL && engine->head == engine->tail;
+}
+
+void i2cEngineAbort(I2cEngine* engine)
+{
+    if(engine->current == NULL) { return; }
+
+    i2cFail(engine, i2c_Status_Bus_Error);
+}
+
+// End of file
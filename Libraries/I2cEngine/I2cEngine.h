@@ -0,0 +1,312 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    I2cEngine.h
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a header file for C language. The purpose is to
+    run queued I2C transactions from the interrupt of the I2C module.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    A transaction is one write, one read or a write followed by a read with
+    a repeated start. The engine keeps a queue of them per I2C module, starts
+    the next one as soon as the previous ends and calls the callback of each
+    one from the interrupt, so a device driver only describes what to send.
+    With a uDMA channel the RX FIFO is emptied by the uDMA and a read of any
+    length costs one interrupt, the stop condition.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#ifndef LIBRARIES_I2CENGINE_I2CENGINE_H_
+#define LIBRARIES_I2CENGINE_I2CENGINE_H_
+
+/* *****************************************************************
+ *                        Included files
+ * *****************************************************************
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_i2c.h"
+#include "driverlib/i2c.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/udma.h"
+
+/* *****************************************************************
+ *                        Macros
+ * *****************************************************************
+ */
+
+// Transactions waiting per module, power of two
+#define I2C_QUEUE_LENGTH       8
+#define I2C_QUEUE_MASK         (I2C_QUEUE_LENGTH - 1)
+
+// Interrupts of the engine, writes need data, reads the stop and the FIFO request or the uDMA done.
+// Every phase ends on a NACK, a slave holding SCL low or a lost arbitration
+#define I2C_ERROR_INTERRUPTS   (I2C_MASTER_INT_NACK | I2C_MASTER_INT_TIMEOUT | I2C_MASTER_INT_ARB_LOST)
+#define I2C_ENGINE_INTERRUPTS  (I2C_ERROR_INTERRUPTS | I2C_MASTER_INT_STOP | I2C_MASTER_INT_DATA | \
+                                I2C_MASTER_INT_RX_FIFO_REQ | I2C_MASTER_INT_RX_DMA_DONE)
+#define I2C_WRITE_INTERRUPTS   (I2C_ERROR_INTERRUPTS | I2C_MASTER_INT_DATA)
+#define I2C_READ_INTERRUPTS    (I2C_ERROR_INTERRUPTS | I2C_MASTER_INT_STOP | I2C_MASTER_INT_RX_FIFO_REQ)
+#define I2C_DMA_READ_INTERRUPTS (I2C_ERROR_INTERRUPTS | I2C_MASTER_INT_STOP | I2C_MASTER_INT_RX_DMA_DONE)
+
+// Clock low timeout, upper 8 bits of the 12 bit counter of SCL periods, about 5 ms at 400 kHz
+#define I2C_CLOCK_LOW_TIMEOUT  0x7D
+
+#define I2C_ENGINE_NO_DMA      0xFFFFFFFF
+
+/* *****************************************************************
+ *                        Definitions
+ * *****************************************************************
+ */
+
+typedef enum
+{
+    i2c_Status_Done    ,
+    i2c_Status_Pending ,
+    i2c_Status_Nack    ,
+    i2c_Status_Bus_Error
+}I2cStatus;
+
+typedef enum
+{
+    i2c_Phase_Idle  ,
+    i2c_Phase_Write ,
+    i2c_Phase_Read
+}I2cPhase;
+
+typedef struct I2cTransaction I2cTransaction;
+
+// Called from the interrupt when the transaction ends, status tells how
+typedef void (*I2cCallback)(I2cTransaction* transaction);
+
+struct I2cTransaction
+{
+    uint8_t         address;
+    const uint8_t*  writeData;
+    uint8_t         writeLength;
+    uint8_t*        readData;
+    uint8_t         readLength;
+    I2cCallback     callback;
+    void*           context;
+    volatile I2cStatus status;
+    uint8_t         count;
+};
+
+typedef struct
+{
+    uint32_t          base;
+    I2cTransaction*   queue[I2C_QUEUE_LENGTH];
+    volatile uint8_t  head;
+    volatile uint8_t  tail;
+    I2cTransaction*   current;
+    I2cPhase          phase;
+    uint32_t          dmaChannel;
+    // A read with uDMA ends when the last byte was moved and the stop was sent, in any order
+    bool              dmaDone;
+    bool              stopSent;
+    uint32_t          transactions;
+    uint32_t          errors;
+}I2cEngine;
+
+/* *****************************************************************
+ *                       Function prototypes
+ * *****************************************************************
+ */
+
+/**
+*****************************************************************************
+*
+*  @brief Initialize the master of an I2C module and its interrupts for the engine
+*
+*  @param[in]   engine      Engine of the module
+*  @param[in]   base        Base address of the module, I2C2_BASE for example
+*  @param[in]   interrupt   Interrupt of the module, INT_I2C2 for example
+*  @param[in]   clock       System clock in Hz
+*
+*  @b example
+*  @code
+*      i2cEngineInit(&sensor_Buses[0].engine, I2C2_BASE, INT_I2C2, SYSCLOCK_SPEED);
+*  @endcode
+*
+*  @note
+*      The peripheral and its pins must be enabled before, the bus runs at 400 kHz
+*
+******************************************************************************
+*/
+
+void i2cEngineInit(I2cEngine* engine, uint32_t base, uint32_t interrupt, uint32_t clock);
+
+/**
+*****************************************************************************
+*
+*  @brief Lets the uDMA empty the RX FIFO of the module during the reads
+*
+*  @param[in]   engine      Engine of the module
+*  @param[in]   channel     uDMA channel of the RX FIFO of the module, with its encoding
+*
+*  @b example
+*  @code
+*      i2cEngineEnableDma(&sensor_Buses[0].engine, SENSOR_I2C_DMA_CHANNEL);
+*  @endcode
+*
+*  @note
+*      The uDMA and its control table must be initialized by the board before
+*
+******************************************************************************
+*/
+
+void i2cEngineEnableDma(I2cEngine* engine, uint32_t channel);
+
+/**
+*****************************************************************************
+*
+*  @brief Fills a transaction, it is not queued until i2cSubmit()
+*
+*  @param[out]  transaction     Transaction to fill
+*  @param[in]   address         7 bit address of the device
+*  @param[in]   writeData       Bytes to write, NULL if writeLength is 0
+*  @param[in]   writeLength     Bytes to write
+*  @param[in]   readData        Buffer for the read, NULL if readLength is 0
+*  @param[in]   readLength      Bytes to read after the write
+*  @param[in]   callback        Called at the end, NULL for none
+*  @param[in]   context         Owner of the transaction for the callback, NULL for none
+*
+*  @b example
+*  @code
+*      i2cTransactionInit(&read, 0x76, &registerAddress, 1, buffer, 3, readDone, &device);
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+
+void i2cTransactionInit(I2cTransaction* transaction, uint8_t address, const uint8_t* writeData, uint8_t writeLength,
+                        uint8_t* readData, uint8_t readLength, I2cCallback callback, void* context);
+
+/**
+*****************************************************************************
+*
+*  @brief Adds a transaction to the queue, it starts at once if the bus is free
+*
+*  @param[in]   engine          Engine of the module
+*  @param[in]   transaction     Transaction to run
+*
+*  @b example
+*  @code
+*      if(!i2cSubmit(&sensor_Buses[0].engine, &read)) { ... }
+*  @endcode
+*
+*  @note
+*      Returns false when the queue is full. Can be called from any interrupt,
+*      callbacks included. The transaction must not be changed until its callback
+*
+******************************************************************************
+*/
+
+bool i2cSubmit(I2cEngine* engine, I2cTransaction* transaction);
+
+/**
+*****************************************************************************
+*
+*  @brief Advances the current transaction, to be called by the interrupt of the module
+*
+*  @param[in]   engine      Engine of the module
+*
+*  @b example
+*  @code
+*      i2cEngineInterrupt(&sensor_Buses[0].engine);
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+
+void i2cEngineInterrupt(I2cEngine* engine);
+
+/**
+*****************************************************************************
+*
+*  @brief Tells if the module has no transaction running or queued
+*
+*  @param[in]   engine      Engine of the module
+*
+*  @b example
+*  @code
+*      if(i2cEngineIdle(&sensor_Buses[0].engine)) { ... }
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+
+bool i2cEngineIdle(I2cEngine* engine);
+
+/**
+*****************************************************************************
+*
+*  @brief Ends the current transaction with i2c_Status_Bus_Error, for a module that stopped interrupting
+*
+*  @param[in]   engine      Engine of the module
+*
+*  @b example
+*  @code
+*      i2cEngineAbort(&sensor_Buses[0].engine);
+*  @endcode
+*
+*  @note
+*      Must be called from an interrupt of the same priority as the one of the module,
+*      the queue goes on with the next transaction
+*
+******************************************************************************
+*/
+
+void i2cEngineAbort(I2cEngine* engine);
+
+#endif /* LIBRARIES_I2CENGINE_I2CENGINE_H_ */
@@ -0,0 +1,80 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Profiling.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a source file for C language. The purpose is to
+    measure the cycles spent by the drivers of the project.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    The counters can be read from the CCS expressions window while the
+    application is running, there is no output of their own.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "Profiling.h"
+
+void initProfiling(void)
+{
+    // Enables the trace block and then the cycle counter
+    HWREG(PROFILING_DEMCR)      |= PROFILING_DEMCR_TRCENA;
+    HWREG(PROFILING_DWT_CYCCNT)  = 0;
+    HWREG(PROFILING_DWT_CTRL)   |= PROFILING_CYCCNTENA;
+}
+
+void profilingStart(ProfilingCounter* counter)
+{
+    counter->startCycles = PROFILING_CYCLES();
+}
+
+void profilingStop(ProfilingCounter* counter)
+{
+    // Unsigned difference is still valid after one wrap of the counter
+    counter->lastCycles = PROFILING_CYCLES() - counter->startCycles;
+    if(counter->lastCycles > counter->maxCycles)
+    {
+        counter->maxCycles = counter->lastCycles;
+    }
+    counter->samples++;
+}
+
+// End of file
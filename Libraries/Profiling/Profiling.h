@@ -0,0 +1,158 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Profiling.h
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a header file for C language. The purpose is to
+    give access to the Cortex-M4 cycle counter to measure the drivers.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    Uses the DWT cycle counter (CYCCNT) of the core, which increments once
+    per system clock. At 120 MHz one cycle is 8.33 ns and the counter wraps
+    every 35.8 s, so unsigned differences are valid for any driver measurement.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#ifndef LIBRARIES_PROFILING_PROFILING_H_
+#define LIBRARIES_PROFILING_PROFILING_H_
+
+/* *****************************************************************
+ *                        Included files
+ * *****************************************************************
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_types.h"
+
+/* *****************************************************************
+ *                        Macros
+ * *****************************************************************
+ */
+
+// Core debug registers, defined by the ARMv7-M architecture manual
+#define PROFILING_DEMCR        0xE000EDFC
+#define PROFILING_DEMCR_TRCENA 0x01000000
+#define PROFILING_DWT_CTRL     0xE0001000
+#define PROFILING_DWT_CYCCNT   0xE0001004
+#define PROFILING_CYCCNTENA    0x00000001
+
+// Reads the current cycle count
+#define PROFILING_CYCLES()     (HWREG(PROFILING_DWT_CYCCNT))
+
+/* *****************************************************************
+ *                        Definitions
+ * *****************************************************************
+ */
+
+// Keeps the last and the worst measurement of a code section
+typedef struct
+{
+    uint32_t startCycles;
+    uint32_t lastCycles;
+    uint32_t maxCycles;
+    uint32_t samples;
+}ProfilingCounter;
+
+/* *****************************************************************
+ *                       Function prototypes
+ * *****************************************************************
+ */
+
+/**
+*****************************************************************************
+*
+*  @brief Enables the DWT cycle counter of the core
+*
+*  @b example
+*  @code
+*      void initProfiling();
+*  @endcode
+*
+*  @note
+*      Must be called before any measurement, otherwise all of them are 0
+*
+******************************************************************************
+*/
+
+void initProfiling(void);
+
+/**
+*****************************************************************************
+*
+*  @brief Marks the beginning of a measured section
+*
+*  @param[in]   counter     Counter that keeps the measurement
+*
+*  @b example
+*  @code
+*      void profilingStart(&counter);
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+
+void profilingStart(ProfilingCounter* counter);
+
+/**
+*****************************************************************************
+*
+*  @brief Marks the end of a measured section and updates last/max cycles
+*
+*  @param[in]   counter     Counter that keeps the measurement
+*
+*  @b example
+*  @code
+*      void profilingStop(&counter);
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+
+void profilingStop(ProfilingCounter* counter);
+
+#endif /* LIBRARIES_PROFILING_PROFILING_H_ */
@@ -53,6 +53,11 @@
 
 #include "Rs232.h"
 
+// Shared by the records and the stream, a gap on the host is a frame lost on the line
+static uint16_t telemetry_Sequence = 0;
+// Samples of the stream not sent yet because of a full ring
+static uint16_t stream_Dropped_Pending = 0;
+
 void initRs232(void)
 {
     // Enables UART0
@@ -69,89 +74,174 @@ void initRs232(void)
     GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
 
     //  Configuration of the message to be send: 8bit word, 1bit of stop and parity none
-    UARTConfigSetExpClk(UART0_BASE, SYSCLOCK_SPEED, UART_SPEED, (UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE));
+    UARTConfigSetExpClk(UART0_BASE, SYSCLOCK_SPEED, uart_Baud, (UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE));
+
+    // The TX interrupt comes when the FIFO goes down to 4 characters
+    UARTFIFOEnable(UART0_BASE);
+    UARTFIFOLevelSet(UART0_BASE, UART_FIFO_TX4_8, UART_FIFO_RX4_8);
+    UARTTxIntModeSet(UART0_BASE, UART_TXINT_MODE_FIFO);
+    UARTIntEnable(UART0_BASE, UART_INT_TX);
+    IntEnable(INT_UART0);
 }
 
-void displayIntValue(const int tempValue, const int state)
+bool uartTxWrite(const char* data, uint8_t length)
 {
-    int  indexCounter = 0, auxValue = abs(tempValue), digitValue = 0, stringLength = MINIMUM_LENGTH_POSITION;
-    char intValueString[NUMBER_MAX_STRING_LENGTH] = {0};
-    if(tempValue < 0)
-    {
-        UARTCharPut(UART0_BASE, MINUS_CHAR);
-    }
-    //Changes the minimum lenth of the string
-    if(state)
+    UartTxSlot* slot;
+    uint32_t    head;
+    uint8_t     index;
+
+    if(length > UART_TX_SLOT_LENGTH)
     {
-        stringLength = FLOATING_POINT_MINIMUM_LENGTH;
+        atomicAdd(&uart_Tx_Ring.drops, length);
+        return false;
     }
-    // Fills the string and then it displays the values in order
+
+    // Reserve a slot, another producer can take it first and then we try the next one
     do
     {
-        digitValue = auxValue % 10 ;
-        auxValue = (auxValue - digitValue)/10;
-        // Checks if the number is integer or float
-        if(indexCounter == DECIMAL_POINT_POSITION && state)
+        head = uart_Tx_Ring.head;
+        if(head - uart_Tx_Ring.tail >= UART_TX_SLOTS)
         {
-            // Adds the decimal point to the value
-            intValueString[NUMBER_MAX_STRING_LENGTH-1-indexCounter] = SINGLE_POINT_CHAR;
-            indexCounter++;
+            atomicAdd(&uart_Tx_Ring.overflows, 1);
+            atomicAdd(&uart_Tx_Ring.drops, length);
+            return false;
         }
-        intValueString[NUMBER_MAX_STRING_LENGTH-1-indexCounter] = digitValue + ZERO_CHAR_VALUE;
-        indexCounter++;
-    }while(auxValue > 0 && indexCounter < NUMBER_MAX_STRING_LENGTH || indexCounter < stringLength);
-    // Displays all values different from NULL
-    for(indexCounter = 0; indexCounter < NUMBER_MAX_STRING_LENGTH; indexCounter++)
+    }while(!atomicCompareAndSwap(&uart_Tx_Ring.head, head, head + 1));
+
+    slot = &uart_Tx_Ring.slots[head & UART_TX_SLOTS_MASK];
+    for(index = 0; index < length; index++)
+    {
+        slot->data[index] = data[index];
+    }
+    slot->length = length;
+    // The line is written before the interrupt can take the slot
+    ATOMIC_BARRIER();
+    slot->ready  = true;
+
+    // The interrupt starts the FIFO if it was empty, otherwise it is already running
+    IntPendSet(INT_UART0);
+    return true;
+}
+
+void uartSetBaud(uint32_t baud)
+{
+    if(baud > UART_SPEED_MAX) { baud = UART_SPEED_MAX; }
+
+    // The characters in the FIFO would change their rate in the middle
+    uartTxFlush();
+    uart_Baud = baud;
+    UARTConfigSetExpClk(UART0_BASE, SYSCLOCK_SPEED, uart_Baud, (UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE));
+}
+
+void uartTxFlush(void)
+{
+    while(uart_Tx_Ring.tail != uart_Tx_Ring.head);
+    while(UARTBusy(UART0_BASE));
+}
+
+void uartTxInterrupt(void)
+{
+    UartTxSlot* slot;
+
+    UARTIntClear(UART0_BASE, UARTIntStatus(UART0_BASE, true));
+
+    while(UARTSpaceAvail(UART0_BASE))
     {
-        if( intValueString[indexCounter] != 0)
+        slot = &uart_Tx_Ring.slots[uart_Tx_Ring.tail & UART_TX_SLOTS_MASK];
+        // A reserved slot still being written stops the FIFO, its producer pends us again
+        if(uart_Tx_Ring.tail == uart_Tx_Ring.head || !slot->ready) { break; }
+        ATOMIC_BARRIER();
+
+        UARTCharPutNonBlocking(UART0_BASE, slot->data[uart_Tx_Ring.offset]);
+        uart_Tx_Ring.offset++;
+        if(uart_Tx_Ring.offset >= slot->length)
         {
-            UARTCharPut(UART0_BASE, intValueString[indexCounter]);
+            uart_Tx_Ring.offset = 0;
+            ATOMIC_BARRIER();
+            slot->ready = false;
+            uart_Tx_Ring.tail++;
         }
     }
 }
 
-void sendTemperatureValueUart(const float tempValue)
+void sendTemperatureValueUart(const float tempValue, const char* statusLabel)
 {
-    float floatValue = tempValue * FLOATING_POINT_MULTIPLIER;
     static uint32_t labelNumber = 1;
-    uint8_t indexCounter = 0;
-    uint8_t labelSize = sizeof(TEMPERATURE_START_LABEL)/sizeof(char);
+    // The buffers of the lines and frames are static, off the system stack of the Swis
+    static char     line[UART_TX_SLOT_LENGTH];
+    uint8_t         lineLength = 0;
+
+    profilingStart(&uart_Format_Cycles);
+    //Initial label and number of iteration
+    lineLength += formatText(&line[lineLength], TEMPERATURE_START_LABEL, sizeof(line) - lineLength);
+    lineLength += formatUnsigned(&line[lineLength], labelNumber);
+    line[lineLength++] = SPACE_CHAR;
+
+    // "Temperature" label
+    lineLength += formatText(&line[lineLength], TEMPERATURE_MID_LABEL, sizeof(line) - lineLength);
+    line[lineLength++] = TWO_POINTS_CHAR;
+    line[lineLength++] = SPACE_CHAR;
+
+    // Temperature Value in tenths, truncated like the display
+    lineLength += formatFixed(&line[lineLength], (int32_t)(tempValue * FLOATING_POINT_MULTIPLIER), FORMAT_TENTHS);
+    line[lineLength++] = SPACE_CHAR;
+
+    // Label of degree Celsius
+    lineLength += formatText(&line[lineLength], TEMPERATURE_UNIT_CHAR, sizeof(line) - lineLength);
+    line[lineLength++] = SPACE_CHAR;
+
+    // Status of the sensor, the end of line always fits
+    lineLength += formatText(&line[lineLength], statusLabel, sizeof(line) - lineLength - 2);
+
+    // An enter for the next value
+    line[lineLength++] = CAR_RETURN_CHAR;
+    line[lineLength++] = LINE_JUMP_CHAR;
+    profilingStop(&uart_Format_Cycles);
+
+    uartTxWrite(line, lineLength);
+    labelNumber++;
+}
 
-    //Sends initial label
-    for(indexCounter = 0; indexCounter < labelSize; indexCounter++)
-    {
-        UARTCharPut(UART0_BASE, TEMPERATURE_START_LABEL[indexCounter]);
-    }
-    //Sends number of iteration
-    displayIntValue(labelNumber, INT_STATE);
-    UARTCharPut(UART0_BASE, SPACE_CHAR);
+void sendTelemetryRecords(TelemetryRecord* records, uint8_t count)
+{
+    static uint8_t frames[UART_TX_SLOT_LENGTH];
+    uint8_t        framesLength = 0;
+    uint8_t        index;
+
+    if(count > UART_TX_RECORDS_MAX) { count = UART_TX_RECORDS_MAX; }
 
-    // Sends "Temperature" label
-    labelSize = sizeof(TEMPERATURE_MID_LABEL)/sizeof(char);
-    for(indexCounter = 0; indexCounter < labelSize; indexCounter++)
+    profilingStart(&uart_Format_Cycles);
+    for(index = 0; index < count; index++)
     {
-        UARTCharPut(UART0_BASE, TEMPERATURE_MID_LABEL[indexCounter]);
+        records[index].sequence = telemetry_Sequence++;
+        framesLength += telemetryEncode(&frames[framesLength], &records[index]);
     }
-    UARTCharPut(UART0_BASE, TWO_POINTS_CHAR);
-    UARTCharPut(UART0_BASE, SPACE_CHAR);
+    profilingStop(&uart_Format_Cycles);
+
+    uartTxWrite((const char*)frames, framesLength);
+}
 
-    // Sends Temperature Value as float
-    // The value must be pre-multiplied by 10
-    displayIntValue((int)floatValue, FLOAT_STATE);
+bool sendTelemetryStream(TelemetryStream* stream)
+{
+    static uint8_t frame[TELEMETRY_STREAM_FRAME_LENGTH];
+    uint8_t        frameLength;
 
-    UARTCharPut(UART0_BASE, SPACE_CHAR);
+    profilingStart(&uart_Format_Cycles);
+    stream->sequence = telemetry_Sequence;
+    stream->dropped  = stream_Dropped_Pending;
+    frameLength      = telemetryEncodeStream(frame, stream);
+    profilingStop(&uart_Format_Cycles);
 
-    // Sends the label of degree Celsius
-    labelSize = sizeof(TEMPERATURE_UNIT_CHAR)/sizeof(char);
-    for(indexCounter = 0; indexCounter < labelSize; indexCounter++)
+    if(!uartTxWrite((const char*)frame, frameLength))
     {
-        UARTCharPut(UART0_BASE, TEMPERATURE_UNIT_CHAR[indexCounter]);
+        uart_Stream_Dropped    += stream->count;
+        // The field of the frame is 16 bits, a long outage reports the maximum
+        stream_Dropped_Pending  = (stream_Dropped_Pending > UINT16_MAX - stream->count) ?
+                                  UINT16_MAX : (uint16_t)(stream_Dropped_Pending + stream->count);
+        return false;
     }
-
-    // Sends an enter for the next value
-    UARTCharPut(UART0_BASE, CAR_RETURN_CHAR);
-    UARTCharPut(UART0_BASE, LINE_JUMP_CHAR);
-
-    labelNumber++;
+    telemetry_Sequence++;
+    stream_Dropped_Pending = 0;
+    return true;
 }
 // End of file
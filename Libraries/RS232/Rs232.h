@@ -25,7 +25,11 @@
 
   @Description
     Using the serial ptrotocol UART, the micro is going to send the information
-    obtained from the temperature sensor. The speed is going to be 115 200 bits/s
+    obtained from the temperature sensor. The speed is going to be 115 200 bits/s,
+    UART_SPEED_STREAM in the streaming mode: 921 600 bits/s through the ICDI or
+    3.75 Mbit/s with UART_STREAM_EXTERNAL_ADAPTER.
+    Every line goes to a ring of slots without waiting for the UART, the TX
+    interrupt of UART0 takes them out to the FIFO.
 
 
     Generation Information :
@@ -60,12 +64,19 @@
  */
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include "inc/hw_memmap.h"
 #include "inc/hw_types.h"
+#include "inc/hw_ints.h"
 #include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
 #include "driverlib/pin_map.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/uart.h"
+#include "../Format/Format.h"
+#include "../Telemetry/Telemetry.h"
+#include "../Profiling/Profiling.h"
+#include "../Atomic/Atomic.h"
 
 /* *****************************************************************
  *                        Macros
@@ -76,27 +87,81 @@
 #define SYSCLOCK_SPEED (uint32_t) 120000000
 
 #define UART_SPEED 115200
+// The divisor of the baud rate is SYSCLOCK_SPEED / (16 * baud), 8 with high speed
+#define UART_SPEED_MAX          (SYSCLOCK_SPEED / 8)
+// The UART0 of the LaunchPad goes to the virtual COM port of the ICDI, that is
+// not made for the 3.75 Mbaud of the stream. 1 when a USB-UART adapter is wired
+// to PA0/PA1 instead, the ICDI side must then be left open
+#ifndef UART_STREAM_EXTERNAL_ADAPTER
+#define UART_STREAM_EXTERNAL_ADAPTER 0
+#endif
+
+#if UART_STREAM_EXTERNAL_ADAPTER
+// Divisor of exactly 2, no error of the fractional part
+#define UART_SPEED_STREAM       (SYSCLOCK_SPEED / 32)
+#else
+// Standard rate of the host drivers, 0.03 % of error with the fractional divisor
+#define UART_SPEED_STREAM       921600
+#endif
 
 #define TEMPERATURE_START_LABEL "No. "
 #define TEMPERATURE_MID_LABEL   "Temperatura"
 #define TEMPERATURE_UNIT_CHAR   "C"
-#define ZERO_CHAR_VALUE         (uint8_t)48
-#define SINGLE_POINT_CHAR       '.'
-#define MINUS_CHAR              '-'
+#define STATUS_NORMAL_LABEL         "Normal"
+#define STATUS_STABILIZING_LABEL    "Estabilizando"
+#define STATUS_ABNORMAL_LABEL       "Anormal"
+#define STATUS_LOST_CONNECTION_LABEL "Sin conexion"
 #define SPACE_CHAR              ' '
 #define TWO_POINTS_CHAR         ':'
 #define CAR_RETURN_CHAR         13
 #define LINE_JUMP_CHAR          10
 
-#define NUMBER_MAX_STRING_LENGTH (uint8_t)10
+#define FLOATING_POINT_MULTIPLIER     10
 
-#define DECIMAL_POINT_POSITION  1
-#define MINIMUM_LENGTH_POSITION 1
-#define INT_STATE               0
-#define FLOAT_STATE             1
+// Ring of transmission, one line per slot, the number of slots must be a power of 2
+#define UART_TX_SLOTS           16
+#define UART_TX_SLOTS_MASK      (UART_TX_SLOTS - 1)
+#define UART_TX_SLOT_LENGTH     128
 
-#define FLOATING_POINT_MULTIPLIER     10
-#define FLOATING_POINT_MINIMUM_LENGTH 3
+// Binary records that fit in one slot
+#define UART_TX_RECORDS_MAX     (UART_TX_SLOT_LENGTH / TELEMETRY_FRAME_LENGTH)
+
+/* *****************************************************************
+ *                       Data types
+ * *****************************************************************
+ */
+
+typedef struct
+{
+    volatile bool       ready;
+    uint8_t             length;
+    char                data[UART_TX_SLOT_LENGTH];
+}UartTxSlot;
+
+// Producers reserve slots moving head with a compare and swap, only the TX interrupt moves tail
+typedef struct
+{
+    UartTxSlot          slots[UART_TX_SLOTS];
+    volatile uint32_t   head;
+    volatile uint32_t   tail;
+    uint8_t             offset;
+    volatile uint32_t   overflows;
+    volatile uint32_t   drops;
+}UartTxRing;
+
+/* *****************************************************************
+ *                       Function variables
+ * *****************************************************************
+ */
+
+extern UartTxRing       uart_Tx_Ring;
+extern ProfilingCounter uart_Format_Cycles;
+extern TelemetryMode    uart_Telemetry_Mode;
+extern uint32_t         uart_Baud;
+extern volatile uint32_t uart_Stream_Dropped;
+extern uint8_t          uart_Stream_Batch;
+// One batch per sensor, filled by the streaming mode of PFinalMain.c
+extern TelemetryStream  uart_Stream_Batches[];
 
 /* *****************************************************************
  *                       Function prototypes
@@ -121,45 +186,155 @@
 
 void initRs232(void);
 
+/**
+*****************************************************************************
+*
+*  @brief Puts a message in the ring of transmission, never waits for the UART
+*
+*  @param[in]   data        Characters to be send
+*  @param[in]   length      Number of characters, up to UART_TX_SLOT_LENGTH
+*
+*  @return      false if the ring is full or the message is too long, the message is dropped
+*
+*  @b example
+*  @code
+*      uartTxWrite(line, lineLength);
+*  @endcode
+*
+*  @note
+*      Safe from tasks, Swis and Hwis at the same time. A full ring increments overflows,
+*      the characters lost are added to drops
+*
+******************************************************************************
+*/
+
+bool uartTxWrite(const char* data, uint8_t length);
+
+/**
+*****************************************************************************
+*
+*  @brief Changes the baud rate of UART0
+*
+*  @param[in]   baud        Bits per second, up to UART_SPEED_MAX
+*
+*  @b example
+*  @code
+*      uartSetBaud(UART_SPEED_STREAM);
+*  @endcode
+*
+*  @note
+*      Waits for the ring with uartTxFlush() first, only from a task or from main.
+*      The rate set is kept in uart_Baud
+*
+******************************************************************************
+*/
+
+void uartSetBaud(uint32_t baud);
+
+/**
+*****************************************************************************
+*
+*  @brief Waits until every message of the ring left the UART
+*
+*  @b example
+*  @code
+*      uartTxFlush();
+*  @endcode
+*
+*  @note
+*      Only from a task or from main, the TX interrupt must be able to run
+*
+******************************************************************************
+*/
+
+void uartTxFlush(void);
+
+/**
+*****************************************************************************
+*
+*  @brief Interrupt of UART0, moves the ready slots of the ring to the TX FIFO
+*
+*  @b example
+*  @code
+*      void uartTxInterrupt();
+*  @endcode
+*
+*  @note
+*      The only consumer of uart_Tx_Ring, uartTxWrite() pends it to start a transmission
+*
+******************************************************************************
+*/
+
+void uartTxInterrupt(void);
+
 /**
 *****************************************************************************
 *
 *  @brief Sends the external temperature value trough the serial protocol
 *
 *  @param[in]   tempValue     Value to be send
+*  @param[in]   statusLabel   Text after the unit, one of the STATUS_*_LABEL
 *
 *  @b example
 *  @code
-*      void sendTemperatureValueUart();
+*      sendTemperatureValueUart(temperature, STATUS_NORMAL_LABEL);
 *  @endcode
 *
 *  @note
-*      N/A
+*      The line is built in place and goes to the ring at once, counted as a drop if it is full.
+*      The buffer of the line is static, only from Swis of one priority
 *
 ******************************************************************************
 */
 
-void sendTemperatureValueUart(const float tempValue);
+void sendTemperatureValueUart(const float tempValue, const char* statusLabel);
 
 /**
 *****************************************************************************
 *
-*  @brief Sends the external temperature value trough the serial protocol
+*  @brief Sends records of the telemetry in binary, framed with COBS
 *
-*  @param[in]   tempValue     Value to be displayed
+*  @param[in,out] records   Records to be send, the sequence is written here
+*  @param[in]   count       Number of records, up to UART_TX_RECORDS_MAX
 *
 *  @b example
 *  @code
-*      void displayIntValue();
+*      sendTelemetryRecords(records, 4);
 *  @endcode
 *
 *  @note
-*      N/A
+*      Every record gets the next sequence number, all of them go to the ring at once.
+*      The buffer of the frames is static, only from Swis of one priority
 *
 ******************************************************************************
 */
 
-void displayIntValue(const int tempValue, const int state);
+void sendTelemetryRecords(TelemetryRecord* records, uint8_t count);
+
+/**
+*****************************************************************************
+*
+*  @brief Sends a batch of samples of the streaming mode, framed with COBS
+*
+*  @param[in,out] stream    Batch to be send, the sequence and the dropped samples are written here
+*
+*  @return      false if the ring was full, the samples are added to uart_Stream_Dropped
+*
+*  @b example
+*  @code
+*      sendTelemetryStream(&batch);
+*  @endcode
+*
+*  @note
+*      The samples lost since the last frame that left are reported in its dropped field,
+*      the sequence only moves with the frames that go to the ring. The buffer of the frame
+*      is static, only from Swis of one priority
+*
+******************************************************************************
+*/
+
+bool sendTelemetryStream(TelemetryStream* stream);
+
 
 
 
@@ -53,55 +53,810 @@
 
 #include "Sensor.h"
 
-void initSensor(void)
+// Pins and interrupt of every bus, in the order of the SENSOR_BUS_* indexes
+typedef struct
 {
-    /* ***********************************
-     *              I2C2 Config
-     * ***********************************
-     */
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPION);
-    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPION));
+    uint32_t i2cPeripheral;
+    uint32_t i2cBase;
+    uint32_t interrupt;
+    uint32_t gpioPeripheral;
+    uint32_t gpioBase;
+    uint32_t sclPinConfig;
+    uint32_t sdaPinConfig;
+    uint8_t  sclPin;
+    uint8_t  sdaPin;
+    uint32_t dmaChannel;
+}SensorBusConfig;
+
+static const SensorBusConfig sensor_Bus_Config[SENSOR_BUS_COUNT] =
+{
+#if SENSOR_I2C_DMA
+    { SYSCTL_PERIPH_I2C2, I2C2_BASE, INT_I2C2, SYSCTL_PERIPH_GPION, GPIO_PORTN_BASE,
+      GPIO_PN5_I2C2SCL, GPIO_PN4_I2C2SDA, GPIO_PIN_5, GPIO_PIN_4, SENSOR_I2C_DMA_CHANNEL },
+#else
+    { SYSCTL_PERIPH_I2C2, I2C2_BASE, INT_I2C2, SYSCTL_PERIPH_GPION, GPIO_PORTN_BASE,
+      GPIO_PN5_I2C2SCL, GPIO_PN4_I2C2SDA, GPIO_PIN_5, GPIO_PIN_4, I2C_ENGINE_NO_DMA },
+#endif
+    { SYSCTL_PERIPH_I2C8, I2C8_BASE, INT_I2C8, SYSCTL_PERIPH_GPIOA, GPIO_PORTA_BASE,
+      GPIO_PA2_I2C8SCL, GPIO_PA3_I2C8SDA, GPIO_PIN_2, GPIO_PIN_3, I2C_ENGINE_NO_DMA },
+#if SENSOR_USE_I2C7
+    { SYSCTL_PERIPH_I2C7, I2C7_BASE, INT_I2C7, SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE,
+      GPIO_PD0_I2C7SCL, GPIO_PD1_I2C7SDA, GPIO_PIN_0, GPIO_PIN_1, I2C_ENGINE_NO_DMA },
+#endif
+};
+
+// Producer side of the ring, called by the interrupts of every I2C bus
+static bool pushTemperatureSample(const SensorSample* sample)
+{
+    SensorSampleSlot* slot;
+    uint32_t          head;
+
+    // Reserve a slot, the interrupt of another bus can take it first and then we try the next one
+    do
+    {
+        head = sensor_Sample_Ring.head;
+        if(head - sensor_Sample_Ring.tail >= SENSOR_RING_LENGTH)
+        {
+            atomicAdd(&sensor_Sample_Ring.overflows, 1);
+            return false;
+        }
+    }while(!atomicCompareAndSwap(&sensor_Sample_Ring.head, head, head + 1));
+
+    slot         = &sensor_Sample_Ring.slots[head & SENSOR_RING_MASK];
+    slot->sample = *sample;
+    // The sample is written before the consumer can take the slot
+    ATOMIC_BARRIER();
+    slot->ready  = true;
+
+    return true;
+}
+
+// Consumer side of the ring, only called by processTemperatureSamples()
+static bool popTemperatureSample(SensorSample* sample)
+{
+    uint32_t          tail = sensor_Sample_Ring.tail;
+    SensorSampleSlot* slot = &sensor_Sample_Ring.slots[tail & SENSOR_RING_MASK];
+
+    // A reserved slot still being written waits for the post of its producer
+    if(tail == sensor_Sample_Ring.head || !slot->ready) { return false; }
+    ATOMIC_BARRIER();
+    *sample     = slot->sample;
+    ATOMIC_BARRIER();
+    slot->ready = false;
+    sensor_Sample_Ring.tail = tail + 1;
+
+    return true;
+}
+
+// Gets the coefficients of the datasheet from the raw registers of the sensor
+static void storeCalibration(SensorDevice* device)
+{
+    const uint8_t*     data        = device->calibrationData;
+    SensorCalibration* calibration = &device->calibration;
+
+    calibration->digitT1 = CALIBRATION_WORD(data, CALIBRATION_INDEX_T1);
+    calibration->digitT2 = (int16_t)CALIBRATION_WORD(data, CALIBRATION_INDEX_T2);
+    calibration->digitT3 = (int16_t)CALIBRATION_WORD(data, CALIBRATION_INDEX_T3);
+
+    calibration->digitP1 = CALIBRATION_WORD(data, CALIBRATION_INDEX_P1);
+    calibration->digitP2 = (int16_t)CALIBRATION_WORD(data, CALIBRATION_INDEX_P2);
+    calibration->digitP3 = (int16_t)CALIBRATION_WORD(data, CALIBRATION_INDEX_P3);
+    calibration->digitP4 = (int16_t)CALIBRATION_WORD(data, CALIBRATION_INDEX_P4);
+    calibration->digitP5 = (int16_t)CALIBRATION_WORD(data, CALIBRATION_INDEX_P5);
+    calibration->digitP6 = (int16_t)CALIBRATION_WORD(data, CALIBRATION_INDEX_P6);
+    calibration->digitP7 = (int16_t)CALIBRATION_WORD(data, CALIBRATION_INDEX_P7);
+    calibration->digitP8 = (int16_t)CALIBRATION_WORD(data, CALIBRATION_INDEX_P8);
+    calibration->digitP9 = (int16_t)CALIBRATION_WORD(data, CALIBRATION_INDEX_P9);
+
+    // H4 and H5 are 12 bits and share the nibbles of 0xE5
+    calibration->digitH1 = data[CALIBRATION_INDEX_H1];
+    calibration->digitH2 = (int16_t)CALIBRATION_WORD(data, CALIBRATION_INDEX_H2);
+    calibration->digitH3 = data[CALIBRATION_INDEX_H3];
+    calibration->digitH4 = (int16_t)(((int8_t)data[CALIBRATION_INDEX_H4] * 16) | (data[CALIBRATION_INDEX_H5] & 0x0F));
+    calibration->digitH5 = (int16_t)(((int8_t)data[CALIBRATION_INDEX_H5 + 1] * 16) | (data[CALIBRATION_INDEX_H5] >> 4));
+    calibration->digitH6 = (int8_t)data[CALIBRATION_INDEX_H6];
+}
+
+static const uint8_t sensor_Calibration_TP_Address = PARAM_CALIBRATION_TP_START;
+static const uint8_t sensor_Calibration_H_Address  = PARAM_CALIBRATION_H_START;
+static const uint8_t sensor_Data_Address          = ADDRESS_READING_START;
+static const uint8_t sensor_Id_Address            = REGISTER_ID;
+
+static I2cEngine* sensorEngine(SensorDevice* device)
+{
+    return &sensor_Buses[device->bus].engine;
+}
+
+// Stops the sampling of the sensor, startTemperatureSample() recovers it after the backoff
+static void sensorFault(SensorDevice* device)
+{
+    SensorSample lost  = { ZERO };
+    uint8_t      shift = device->recoveryAttempts;
+
+    device->state = state_Error;
+    device->errors++;
+    GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_1, GPIO_PIN_1);
+
+    // The recovery time counts from the first fault, not from the failed attempts
+    if(!device->recovering) {
+        device->recovering = true;
+        device->faultTick  = sensor_Tick_Count;
+        shift              = ZERO;
+    }
+    if(shift > SENSOR_RECOVERY_MAX_SHIFT) { shift = SENSOR_RECOVERY_MAX_SHIFT; }
+    device->backoffTicks = (uint8_t)(1 << shift);
+
+    // Still retried at the longest backoff, but flagged as disconnected
+    if(device->recoveryAttempts < LOST_CONNECTION_LIMIT) { device->recoveryAttempts++; }
+    else {
+        device->lostConnection = true;
+        // Only the Swi writes the status, a full ring gets it at the next failed attempt
+        if(device->index == SENSOR_PRIMARY) {
+            lost.timestamp      = PROFILING_CYCLES();
+            lost.sensor         = device->index;
+            lost.lostConnection = true;
+            pushTemperatureSample(&lost);
+        }
+    }
+}
+
+// A transaction that fails stops the sampling of its sensor and turns on the error LED
+static bool sensorTransactionFailed(I2cTransaction* transaction)
+{
+    SensorDevice* device = (SensorDevice*)transaction->context;
+
+    // Transactions queued before the fault end after it, they are ignored
+    if(device->state == state_Error) { return true; }
+#if SENSOR_FAULT_INJECTION
+    if(sensor_Injected_Faults != ZERO && transaction->status == i2c_Status_Done) {
+        sensor_Injected_Faults--;
+        transaction->status = i2c_Status_Nack;
+    }
+#endif
+    if(transaction->status == i2c_Status_Done) { return false; }
+
+    sensorFault(device);
+
+    return true;
+}
+
+// First good sample after a fault, the LED is off once every sensor is back
+static void sensorRecovered(SensorDevice* device)
+{
+    uint8_t device_Index;
+
+    device->recovering       = false;
+    device->lostConnection   = false;
+    device->recoveryAttempts = ZERO;
+    device->recoveryMs       = (sensor_Tick_Count - device->faultTick) * SENSOR_TICK_MS;
+    if(device->recoveryMs > sensor_Recovery_Ms_Max)   { sensor_Recovery_Ms_Max = device->recoveryMs; }
+    if(device->recoveryMs > SENSOR_RECOVERY_BOUND_MS) { sensor_Recovery_Over_Bound++; }
+
+    for(device_Index = ZERO; device_Index < sensor_Device_Count; device_Index++)
+    {
+        if(sensor_Devices[device_Index].recovering) { return; }
+    }
+    GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_1, ZERO);
+}
+
+// Clocks SCL until a slave that was left in the middle of a byte releases SDA, then sends a stop
+static void clearSensorBus(uint8_t bus)
+{
+    const SensorBusConfig* config = &sensor_Bus_Config[bus];
+    uint8_t                pulse;
+
+    GPIOPinTypeGPIOInput(config->gpioBase, config->sdaPin);
+    GPIOPinWrite(config->gpioBase, config->sclPin, config->sclPin);
+    GPIOPinTypeGPIOOutputOD(config->gpioBase, config->sclPin);
+    for(pulse = ZERO; pulse < SENSOR_BUS_CLEAR_PULSES; pulse++)
+    {
+        if(GPIOPinRead(config->gpioBase, config->sdaPin) != ZERO) { break; }
+        GPIOPinWrite(config->gpioBase, config->sclPin, ZERO);
+        SysCtlDelay(SENSOR_BUS_CLEAR_DELAY);
+        GPIOPinWrite(config->gpioBase, config->sclPin, config->sclPin);
+        SysCtlDelay(SENSOR_BUS_CLEAR_DELAY);
+    }
+
+    // Start and stop, SDA falls and rises while SCL is high, every slave goes back to idle
+    GPIOPinWrite(config->gpioBase, config->sdaPin, ZERO);
+    GPIOPinTypeGPIOOutputOD(config->gpioBase, config->sdaPin);
+    SysCtlDelay(SENSOR_BUS_CLEAR_DELAY);
+    GPIOPinWrite(config->gpioBase, config->sdaPin, config->sdaPin);
+    SysCtlDelay(SENSOR_BUS_CLEAR_DELAY);
+
+    GPIOPinConfigure(config->sclPinConfig);
+    GPIOPinConfigure(config->sdaPinConfig);
+    GPIOPinTypeI2C(config->gpioBase, config->sdaPin);
+    GPIOPinTypeI2CSCL(config->gpioBase, config->sclPin);
+}
+
+// A master left in the middle of a transfer by the slave only goes back to idle with a reset
+static void resetSensorBus(uint8_t bus)
+{
+    const SensorBusConfig* config = &sensor_Bus_Config[bus];
+
+    SysCtlPeripheralReset(config->i2cPeripheral);
+    while(!SysCtlPeripheralReady(config->i2cPeripheral));
+    i2cEngineInit(&sensor_Buses[bus].engine, config->i2cBase, config->interrupt, SYSCLOCK_SPEED);
+    if(config->dmaChannel != I2C_ENGINE_NO_DMA) { i2cEngineEnableDma(&sensor_Buses[bus].engine, config->dmaChannel); }
+}
+
+// The bus is idle while the sensor converts, sensorMeasureTimeout() reads the result.
+// TIMER3 is shared by every bus, each write restarts it so it ends after the last conversion
+static void startMeasureTimer(SensorDevice* device)
+{
+    device->state = state_Adc_Wait_For_Measure_Finish;
+    TimerDisable(TIMER3_BASE, TIMER_A);
+    TimerLoadSet(TIMER3_BASE, TIMER_A, (SYSCLOCK_SPEED / MICROSECONDS_PER_SECOND) * sensor_Measure_Time);
+    TimerEnable(TIMER3_BASE, TIMER_A);
+}
+
+static void calibrationRead(I2cTransaction* transaction)
+{
+    SensorDevice* device = (SensorDevice*)transaction->context;
 
-    GPIOPinConfigure(GPIO_PN5_I2C2SCL);
-    GPIOPinConfigure(GPIO_PN4_I2C2SDA);
-    GPIOPinTypeI2C(GPIO_PORTN_BASE, GPIO_PIN_4);
-    GPIOPinTypeI2CSCL(GPIO_PORTN_BASE, GPIO_PIN_5);
+    if(sensorTransactionFailed(transaction)) { return; }
+
+    // Both blocks are in calibrationData after the humidity one
+    if(transaction == &device->calibrationHRead)
+    {
+        storeCalibration(device);
+        device->calibrated = true;
+        device->state      = state_Write_Mode_Configuration;
+    }
+}
+
+static void resetWritten(I2cTransaction* transaction)
+{
+    if(sensorTransactionFailed(transaction)) { return; }
+
+    // The sensor needs 2 ms to start, its ID is read with the next tick
+    ((SensorDevice*)transaction->context)->state = state_Recovery_Startup;
+}
+
+static void modeWritten(I2cTransaction* transaction)
+{
+    SensorDevice* device = (SensorDevice*)transaction->context;
+
+    if(sensorTransactionFailed(transaction)) { return; }
+
+    // Forced mode already started a conversion with the last byte
+    if((device->modeBurst[SENSOR_MODE_BURST_LENGTH - 1] & MODE_MASK) == MODE_NORMAL)
+    {
+        // The timer starts the next read
+        device->state = state_Adc_Idle;
+    }
+    else { startMeasureTimer(device); }
+}
+
+static void ctrlMeasWritten(I2cTransaction* transaction)
+{
+    if(sensorTransactionFailed(transaction)) { return; }
+
+    startMeasureTimer((SensorDevice*)transaction->context);
+}
+
+static void startDeviceSample(SensorDevice* device);
+
+static void measurementRead(I2cTransaction* transaction)
+{
+    SensorDevice* device = (SensorDevice*)transaction->context;
+    const uint8_t* data  = device->adcData;
+    SensorSample  sample;
+
+    if(sensorTransactionFailed(transaction)) { return; }
+
+    if(device->index == SENSOR_PRIMARY)
+    {
+        profilingStop(&sensor_Bus_Cycles);
+        profilingStop(&sensor_Sample_Cycles);
+    }
+    // Pressure and temperature are 20 bits, the XLSB only has the 4 upper bits
+    sample.adcPressure    = ((uint32_t)data[SENSOR_DATA_PRESSURE] << 12)        |
+                            ((uint32_t)data[SENSOR_DATA_PRESSURE + 1] << 4)     |
+                            ((uint32_t)data[SENSOR_DATA_PRESSURE + 2] >> 4);
+    sample.adcTemperature = ((uint32_t)data[SENSOR_DATA_TEMPERATURE] << 12)     |
+                            ((uint32_t)data[SENSOR_DATA_TEMPERATURE + 1] << 4)  |
+                            ((uint32_t)data[SENSOR_DATA_TEMPERATURE + 2] >> 4);
+    sample.adcHumidity    = ((uint32_t)data[SENSOR_DATA_HUMIDITY] << 8)         |
+                            (uint32_t)data[SENSOR_DATA_HUMIDITY + 1];
+    sample.timestamp      = PROFILING_CYCLES();
+    sample.sensor         = device->index;
+    sample.lostConnection = false;
+    // Only the raw words leave the interrupt, the processing runs in processTemperatureSamples()
+    pushTemperatureSample(&sample);
+    // The sensor is free for the next sample
+    device->state      = state_Adc_Idle;
+    device->stuckTicks = ZERO;
+    if(device->recovering) { sensorRecovered(device); }
+    // Streaming does not wait for the tick, the next conversion starts now
+    if(sensor_Streaming) { startDeviceSample(device); }
+}
+
+// Writes config and ctrl_meas, the sensor sleeps first because config is ignored in normal mode
+static void startModeConfiguration(SensorDevice* device)
+{
+    device->modeBurst[0] = REGISTER_CTRL_HUM;
+    device->modeBurst[1] = sensor_Ctrl_Hum;
+    device->modeBurst[2] = REGISTER_MEASCTRL;
+    device->modeBurst[3] = (sensor_Ctrl_Meas & ~MODE_MASK) | MODE_SLEEP;
+    device->modeBurst[4] = REGISTER_CONFIG;
+    device->modeBurst[5] = sensor_Config;
+    device->modeBurst[6] = REGISTER_MEASCTRL;
+    device->modeBurst[7] = sensor_Ctrl_Meas;
+
+    device->modeUpdate = false;
+    if(device->state != state_Read_Calibration) { device->state = state_Write_Mode_Configuration; }
+    i2cSubmit(sensorEngine(device), &device->modeWrite);
+}
+
+// Write of ADDRESS_READING_START and read of the three channels with a repeated start
+static void startTemperatureRead(SensorDevice* device)
+{
+    device->state = state_Adc_Reading_In_Progress;
+    // Bus time of the sample, from the address write to the end of the read
+    if(device->index == SENSOR_PRIMARY) { profilingStart(&sensor_Bus_Cycles); }
+    i2cSubmit(sensorEngine(device), &device->measurementRead);
+}
+
+static void idRead(I2cTransaction* transaction)
+{
+    SensorDevice* device = (SensorDevice*)transaction->context;
+
+    if(sensorTransactionFailed(transaction)) { return; }
+
+    // Another device answering at the address is a fault too
+    if(device->chipId != SENSOR_CHIP_ID)
+    {
+        sensorFault(device);
+        return;
+    }
+    // The coefficients are in the NVM of the sensor, the ones read before the fault are still valid
+    if(!device->calibrated)
+    {
+        device->state = state_Read_Calibration;
+        i2cSubmit(sensorEngine(device), &device->calibrationTPRead);
+        i2cSubmit(sensorEngine(device), &device->calibrationHRead);
+    }
+    // The soft reset left the sensor in sleep with the default configuration
+    startModeConfiguration(device);
+}
+
+// The bus clear waits for the Swi, from now on the tick does not use the bus
+static bool startRecovery(SensorDevice* device)
+{
+    // The clock pulses take the bus, the transactions of the other sensors end first
+    if(!i2cEngineIdle(sensorEngine(device))) { return false; }
+
+    device->state                      = state_Recovery_Clear;
+    sensor_Buses[device->bus].clearing = true;
+
+    return true;
+}
+
+// Soft reset after the bus clear, the rest of the recovery runs in the callbacks and the next tick
+static void startRecoveryReset(SensorDevice* device)
+{
+    device->resetBurst[0] = REGISTER_RESET;
+    device->resetBurst[1] = SENSOR_RESET_VALUE;
+    device->state         = state_Recovery_Reset;
+    i2cSubmit(sensorEngine(device), &device->resetWrite);
+}
+
+static void startDeviceSample(SensorDevice* device)
+{
+    if(device->index == SENSOR_PRIMARY) { profilingStart(&sensor_Sample_Cycles); }
+
+    if(device->modeUpdate) { startModeConfiguration(device); }
+    else if((sensor_Ctrl_Meas & MODE_MASK) == MODE_NORMAL) {
+        // The sensor converts on its own, only the data is read
+        startTemperatureRead(device);
+    } else {
+        device->state            = state_Adc_Measure_Started;
+        device->ctrlMeasBurst[0] = REGISTER_MEASCTRL;
+        device->ctrlMeasBurst[1] = sensor_Ctrl_Meas;
+        i2cSubmit(sensorEngine(device), &device->ctrlMeasWrite);
+    }
+}
+
+// Maximum conversion time of the datasheet (appendix B) for the oversampling in ctrl_meas and ctrl_hum
+static uint32_t measureTime(uint8_t ctrl_meas, uint8_t ctrl_hum)
+{
+    uint8_t  temperature_Oversampling = (ctrl_meas >> OSRS_T_SHIFT) & OSRS_MASK;
+    uint8_t  pressure_Oversampling    = (ctrl_meas >> OSRS_P_SHIFT) & OSRS_MASK;
+    uint8_t  humidity_Oversampling    = (ctrl_hum >> OSRS_H_SHIFT) & OSRS_MASK;
+    uint32_t measure_Time             = MEASURE_TIME_BASE_US;
+
+    // Register codes 1..5 are 1x..16x, anything above 5 is 16x too
+    if(temperature_Oversampling > OSRS_CODE_16) { temperature_Oversampling = OSRS_CODE_16; }
+    if(pressure_Oversampling > OSRS_CODE_16)    { pressure_Oversampling    = OSRS_CODE_16; }
+    if(humidity_Oversampling > OSRS_CODE_16)    { humidity_Oversampling    = OSRS_CODE_16; }
+
+    if(temperature_Oversampling != ZERO) {
+        measure_Time += MEASURE_TIME_PER_SAMPLE_US << (temperature_Oversampling - 1);
+    }
+    if(pressure_Oversampling != ZERO) {
+        measure_Time += (MEASURE_TIME_PER_SAMPLE_US << (pressure_Oversampling - 1)) + MEASURE_TIME_CHANNEL_US;
+    }
+    if(humidity_Oversampling != ZERO) {
+        measure_Time += (MEASURE_TIME_PER_SAMPLE_US << (humidity_Oversampling - 1)) + MEASURE_TIME_CHANNEL_US;
+    }
+
+    return measure_Time;
+}
+
+// Sliding window average, the oldest sample leaves the running sum when the new one enters
+static int32_t updateAverage(int32_t temperature)
+{
+    // A new window length starts an empty window
+    if(sensor_Window_Request != sensor_Window_Length) {
+        sensor_Window_Length   = sensor_Window_Request;
+        sensor_Window_Count    = ZERO;
+        sensor_Current_Sample  = ZERO;
+        sensor_Temperature_Sum = ZERO;
+    }
+
+    if(sensor_Window_Count == sensor_Window_Length) {
+        sensor_Temperature_Sum -= sensor_Temperature_Array[sensor_Current_Sample];
+    } else {
+        sensor_Window_Count++;
+    }
+    sensor_Temperature_Array[sensor_Current_Sample] = temperature;
+    sensor_Temperature_Sum += temperature;
+
+    sensor_Current_Sample++;
+    if(sensor_Current_Sample >= sensor_Window_Length) { sensor_Current_Sample = ZERO; }
+
+    // Until the window is full the average only has the samples received
+    return sensor_Temperature_Sum / (int32_t)sensor_Window_Count;
+}
+
+static void initSensorBus(uint8_t bus)
+{
+    const SensorBusConfig* config = &sensor_Bus_Config[bus];
+
+    SysCtlPeripheralEnable(config->gpioPeripheral);
+    while(!SysCtlPeripheralReady(config->gpioPeripheral));
+
+    GPIOPinConfigure(config->sclPinConfig);
+    GPIOPinConfigure(config->sdaPinConfig);
+    GPIOPinTypeI2C(config->gpioBase, config->sdaPin);
+    GPIOPinTypeI2CSCL(config->gpioBase, config->sclPin);
 
     // I2C Initialization
-    SysCtlPeripheralDisable(SYSCTL_PERIPH_I2C2);
-    SysCtlPeripheralReset(SYSCTL_PERIPH_I2C2);
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_I2C2);
-    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_I2C2));
-    I2CMasterInitExpClk(I2C2_BASE, SYSCLOCK_SPEED, true);
-    I2CMasterIntEnableEx(I2C2_BASE, (I2C_MASTER_INT_STOP | I2C_MASTER_INT_NACK | I2C_MASTER_INT_DATA));
-    IntEnable(INT_I2C2);
-    while(I2CMasterBusBusy(I2C2_BASE));
+    SysCtlPeripheralDisable(config->i2cPeripheral);
+    SysCtlPeripheralReset(config->i2cPeripheral);
+    SysCtlPeripheralEnable(config->i2cPeripheral);
+    while(!SysCtlPeripheralReady(config->i2cPeripheral));
+    i2cEngineInit(&sensor_Buses[bus].engine, config->i2cBase, config->interrupt, SYSCLOCK_SPEED);
+    if(config->dmaChannel != I2C_ENGINE_NO_DMA) { i2cEngineEnableDma(&sensor_Buses[bus].engine, config->dmaChannel); }
+}
 
-    I2CMasterSlaveAddrSet(I2C2_BASE, SLAVE_ADDRESS_EXT, false);
-    I2CMasterDataPut(I2C2_BASE, sensor_Parameter_Address);
-    I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_SINGLE_SEND);
+// Welford update of the mean and variance, the count stops at the window so old samples fade out
+static void updateStatistics(SensorStatistics* statistics, int32_t temperature)
+{
+    int32_t delta;
+    int32_t delta_New;
+    int64_t spread;
+
+    if(statistics->count < SENSOR_STATISTICS_WINDOW) { statistics->count++; }
+
+    delta                = temperature * SENSOR_MEAN_SCALE - statistics->meanQ8;
+    statistics->meanQ8  += delta / statistics->count;
+    delta_New            = temperature * SENSOR_MEAN_SCALE - statistics->meanQ8;
+    spread               = ((int64_t)delta * delta_New) >> (2 * SENSOR_MEAN_SHIFT);
+    statistics->variance += (int32_t)((spread - statistics->variance) / statistics->count);
 }
 
-void initADC0(void)
+static void restartStatistics(SensorStatistics* statistics, int32_t temperature)
 {
+    statistics->meanQ8      = temperature * SENSOR_MEAN_SCALE;
+    statistics->variance    = ZERO;
+    statistics->count       = 1;
+    statistics->calmSamples = ZERO;
+}
+
+// O(1) classifier of the samples, a jump from the last accepted sample or a value far from the mean
+// of the stable samples is abnormal, MAXIMUM_STABILIZING_SAMPLES calm samples in a row are normal again
+DetaTemperatureStatus classifyTemperature(SensorStatistics* statistics, DetaTemperatureStatus status, int32_t temperature)
+{
+    int32_t step      = temperature - statistics->previous;
+    int32_t deviation = temperature - (statistics->meanQ8 >> SENSOR_MEAN_SHIFT);
+    int32_t repeat    = temperature - statistics->rejected;
+
+    if(step < 0)      { step = -step; }
+    if(deviation < 0) { deviation = -deviation; }
+    if(repeat < 0)    { repeat = -repeat; }
+
+    // First sample, or first one after the sensor came back
+    if(statistics->count == ZERO || status == data_Temp_LostConnection)
+    {
+        restartStatistics(statistics, temperature);
+        status = data_Temp_Stabilizing;
+    }
+    else if(status == data_Temp_Abnormal)
+    {
+        // Out of the statistics until the temperature is back or settles at a new level
+        if(step <= DELTA_TEMPERATURE_LOWER_LIMIT * CENTIDEGREES_PER_DEGREE)
+        {
+            // The abnormal samples were a spike, the statistics before it are still good
+            updateStatistics(statistics, temperature);
+        }
+        else if(repeat <= DELTA_TEMPERATURE_LOWER_LIMIT * CENTIDEGREES_PER_DEGREE)
+        {
+            // The new level after an abnormal jump is the start of new statistics
+            restartStatistics(statistics, temperature);
+        }
+        else
+        {
+            statistics->rejected = temperature;
+            return status;
+        }
+        status = data_Temp_Stabilizing;
+        statistics->calmSamples++;
+    }
+    else if(step > DELTA_TEMPERATURE_UPPER_LIMIT * CENTIDEGREES_PER_DEGREE ||
+            (status == data_Temp_Normal &&
+             deviation > DELTA_TEMPERATURE_LOWER_LIMIT * CENTIDEGREES_PER_DEGREE &&
+             (int64_t)deviation * deviation > (int64_t)SENSOR_ANOMALY_SIGMAS * SENSOR_ANOMALY_SIGMAS * statistics->variance))
+    {
+        // A single bad read must not move the mean nor the reference of the next step
+        statistics->calmSamples = ZERO;
+        statistics->rejected    = temperature;
+        return data_Temp_Abnormal;
+    }
+    else if(step > DELTA_TEMPERATURE_LOWER_LIMIT * CENTIDEGREES_PER_DEGREE)
+    {
+        statistics->calmSamples = ZERO;
+        if(status == data_Temp_Normal) { status = data_Temp_Stabilizing; }
+        updateStatistics(statistics, temperature);
+    }
+    else
+    {
+        updateStatistics(statistics, temperature);
+        if(status == data_Temp_Stabilizing)
+        {
+            statistics->calmSamples++;
+            if(statistics->calmSamples >= MAXIMUM_STABILIZING_SAMPLES) { status = data_Temp_Normal; }
+        }
+    }
+    statistics->previous = temperature;
+
+    return status;
+}
+
+void initSensor(void)
+{
+    uint8_t bus;
+
     /* ***********************************
-     *              ADC0 Config
+     *         I2C2, I2C8, I2C7 Config
      * ***********************************
      */
-    /* Enable the peripheral ADC0 */
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC0);
+    for(bus = ZERO; bus < SENSOR_BUS_COUNT; bus++) { initSensorBus(bus); }
+
+    // One shot timer for the conversion time of forced mode
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER3);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER3));
+    TimerConfigure(TIMER3_BASE, TIMER_CFG_ONE_SHOT);
+    TimerIntEnable(TIMER3_BASE, TIMER_TIMA_TIMEOUT);
+    IntEnable(INT_TIMER3A);
+    sensor_Measure_Time = measureTime(sensor_Ctrl_Meas, sensor_Ctrl_Hum);
+
+    profilingStart(&sensor_Startup_Cycles);
+    addSensor(SENSOR_BUS_I2C2, SLAVE_ADDRESS_EXT);
+}
+
+bool addSensor(uint8_t bus, uint8_t address)
+{
+    SensorBus*    sensor_Bus;
+    SensorDevice* device;
+    uint8_t       device_Index;
+
+    if(bus >= SENSOR_BUS_COUNT || sensor_Device_Count >= SENSOR_MAX_DEVICES) { return false; }
+    sensor_Bus = &sensor_Buses[bus];
+    if(sensor_Bus->count >= SENSOR_MAX_PER_BUS) { return false; }
+    for(device_Index = ZERO; device_Index < sensor_Bus->count; device_Index++)
+    {
+        if(sensor_Bus->devices[device_Index]->address == address) { return false; }
+    }
+
+    device          = &sensor_Devices[sensor_Device_Count];
+    device->address = address;
+    device->index   = sensor_Device_Count;
+    device->bus     = bus;
+    device->state   = state_Read_Calibration;
+
+    i2cTransactionInit(&device->resetWrite, address, device->resetBurst, SENSOR_RESET_BURST_LENGTH, NULL, 0, resetWritten, device);
+    i2cTransactionInit(&device->idRead, address, &sensor_Id_Address, 1, &device->chipId, 1, idRead, device);
+    i2cTransactionInit(&device->calibrationTPRead, address, &sensor_Calibration_TP_Address, 1,
+                       device->calibrationData, PARAM_CALIBRATION_TP_LENGTH, calibrationRead, device);
+    i2cTransactionInit(&device->calibrationHRead, address, &sensor_Calibration_H_Address, 1,
+                       &device->calibrationData[PARAM_CALIBRATION_TP_LENGTH], PARAM_CALIBRATION_H_LENGTH, calibrationRead, device);
+    i2cTransactionInit(&device->modeWrite, address, device->modeBurst, SENSOR_MODE_BURST_LENGTH, NULL, 0, modeWritten, device);
+    i2cTransactionInit(&device->ctrlMeasWrite, address, device->ctrlMeasBurst, SENSOR_CTRL_MEAS_BURST_LENGTH, NULL, 0, ctrlMeasWritten, device);
+    i2cTransactionInit(&device->measurementRead, address, &sensor_Data_Address, 1,
+                       device->adcData, SENSOR_DATA_LENGTH, measurementRead, device);
+
+    // The timers only see the sensor once it is filled, it is skipped until it is configured
+    sensor_Bus->devices[sensor_Bus->count] = device;
+    sensor_Bus->count++;
+    sensor_Device_Count++;
+
+    // Calibration and configuration are queued together, the engine runs them back to back
+    i2cSubmit(&sensor_Bus->engine, &device->calibrationTPRead);
+    i2cSubmit(&sensor_Bus->engine, &device->calibrationHRead);
+    startModeConfiguration(device);
+
+    return true;
+}
+
+void configureSensorMode(uint8_t mode, uint8_t standby, uint8_t filter)
+{
+    uint8_t device_Index;
 
-    /* Configure the trigger mode and prority */
-    ADCSequenceConfigure(ADC0_BASE, 1, ADC_TRIGGER_PROCESSOR, 0);
+    sensor_Ctrl_Meas    = (sensor_Ctrl_Meas & ~MODE_MASK) | (mode & MODE_MASK);
+    sensor_Config       = standby | filter;
+    sensor_Measure_Time = measureTime(sensor_Ctrl_Meas, sensor_Ctrl_Hum);
+    // Applied by the next sample of every sensor, never in the middle of a transaction
+    for(device_Index = ZERO; device_Index < sensor_Device_Count; device_Index++)
+    {
+        sensor_Devices[device_Index].modeUpdate = true;
+    }
+}
 
-    /* Configure the step */
-    ADCSequenceStepConfigure(ADC0_BASE, 1, 0, ADC_CTL_TS);
-    ADCSequenceStepConfigure(ADC0_BASE, 1, 1, ADC_CTL_TS);
-    ADCSequenceStepConfigure(ADC0_BASE, 1, 2, ADC_CTL_TS);
-    /* Last step */
-    ADCSequenceStepConfigure(ADC0_BASE,1,3,ADC_CTL_TS|ADC_CTL_IE|ADC_CTL_END);
-    /* Enables conversion */
-    ADCSequenceEnable(ADC0_BASE, 1);
+void setTemperatureFilters(uint8_t count)
+{
+    if(count > FILTER_MAX_STAGES) { count = FILTER_MAX_STAGES; }
+
+    // The interrupt sees an empty chain while the stages are cleared
+    sensor_Filter_Count = ZERO;
+    filterReset(sensor_Filters, count);
+    sensor_Filter_Count = count;
+
+    // The IIR stage is done by the sensor, it is programmed in the config register
+    configureSensorMode(sensor_Ctrl_Meas & MODE_MASK, sensor_Config & T_SB_MASK, filterSensorIir(sensor_Filters, count));
+}
+
+void setTemperatureWindow(uint8_t length)
+{
+    if(length == ZERO) { length = 1; }
+    else if(length > TEMPERATURE_SAMPLES_MAX) { length = TEMPERATURE_SAMPLES_MAX; }
+    // Taken by the I2C2 interrupt with the next sample
+    sensor_Window_Request = length;
+}
+
+void sensorSetStreaming(bool enable)
+{
+    static uint8_t mode_Saved = MODE_NORMAL;
+
+    if(enable == sensor_Streaming) { return; }
+    if(enable)
+    {
+        // Normal mode would give the same data again, forced mode converts once per read
+        mode_Saved = sensor_Ctrl_Meas & MODE_MASK;
+        configureSensorMode(MODE_FORCED, sensor_Config & T_SB_MASK, sensor_Config & IIR_MASK);
+    }
+    else
+    {
+        configureSensorMode(mode_Saved, sensor_Config & T_SB_MASK, sensor_Config & IIR_MASK);
+    }
+    sensor_Streaming = enable;
+}
+
+void sensorMeasureTimeout(void)
+{
+    SensorDevice* device;
+    uint8_t       device_Index;
+
+    TimerIntClear(TIMER3_BASE, TIMER_TIMA_TIMEOUT);
+    for(device_Index = ZERO; device_Index < sensor_Device_Count; device_Index++)
+    {
+        device = &sensor_Devices[device_Index];
+        if(device->state != state_Adc_Wait_For_Measure_Finish) { continue; }
+        // The reset of the module loses the conversion, the next tick starts another one
+        if(sensor_Buses[device->bus].clearing) { device->state = state_Adc_Idle; }
+        else { startTemperatureRead(device); }
+    }
+}
+
+// Starts the sample of an idle sensor, advances the recovery of a failed one.
+// Returns true when its bus waits for the clear of the Swi
+static bool serviceSensor(SensorDevice* device)
+{
+    bool clear = false;
+
+    switch(device->state)
+    {
+        case state_Adc_Idle:
+            device->stuckTicks = ZERO;
+            startDeviceSample(device);
+            break;
+        case state_Error:
+            device->stuckTicks = ZERO;
+            if(device->backoffTicks != ZERO) { device->backoffTicks--; }
+            if(device->backoffTicks == ZERO) { clear = startRecovery(device); }
+            break;
+        case state_Recovery_Startup:
+            device->state = state_Recovery_Check_Id;
+            i2cSubmit(sensorEngine(device), &device->idRead);
+            break;
+        case state_Adc_Wait_For_Measure_Finish:
+            // TIMER3 ends the wait
+            break;
+        default:
+            // A module that stopped interrupting never ends its transaction
+            device->stuckTicks++;
+            if(device->stuckTicks >= SENSOR_STUCK_TICKS)
+            {
+                device->stuckTicks = ZERO;
+                i2cEngineAbort(sensorEngine(device));
+            }
+            break;
+    }
+
+    return clear;
+}
+
+bool startTemperatureSample(void)
+{
+    SensorBus* sensor_Bus;
+    uint32_t   ring_Head = sensor_Sample_Ring.head;
+    uint8_t    bus;
+    uint8_t    slot;
+    uint8_t    device_Slot;
+    bool       clear = false;
+
+    sensor_Tick_Count++;
+    // The buses run in parallel, the sensors of one bus share its queue in round robin
+    for(bus = ZERO; bus < SENSOR_BUS_COUNT; bus++)
+    {
+        sensor_Bus = &sensor_Buses[bus];
+        if(sensor_Bus->count == ZERO) { continue; }
+        // The Swi did not clear it yet, it may have been preempted by this tick
+        if(sensor_Bus->clearing) {
+            clear = true;
+            continue;
+        }
+
+        device_Slot = sensor_Bus->next;
+        for(slot = ZERO; slot < sensor_Bus->count; slot++)
+        {
+            // A sensor that found the bus being cleared leaves it to the Swi
+            if(sensor_Bus->clearing) { break; }
+            clear |= serviceSensor(sensor_Bus->devices[device_Slot]);
+            device_Slot++;
+            if(device_Slot >= sensor_Bus->count) { device_Slot = ZERO; }
+        }
+        // Another sensor goes first the next time
+        sensor_Bus->next++;
+        if(sensor_Bus->next >= sensor_Bus->count) { sensor_Bus->next = ZERO; }
+    }
+
+    // The abort of a stuck transaction runs its callback here
+    return clear || ring_Head != sensor_Sample_Ring.head;
+}
+
+void recoverSensorBuses(void)
+{
+    SensorBus* sensor_Bus;
+    uint8_t    bus;
+    uint8_t    slot;
+
+    for(bus = ZERO; bus < SENSOR_BUS_COUNT; bus++)
+    {
+        sensor_Bus = &sensor_Buses[bus];
+        if(!sensor_Bus->clearing) { continue; }
+
+        // The engine was idle when the tick gave the bus to the Swi, nothing else queues on it
+        clearSensorBus(bus);
+        resetSensorBus(bus);
+        for(slot = ZERO; slot < sensor_Bus->count; slot++)
+        {
+            if(sensor_Bus->devices[slot]->state == state_Recovery_Clear) { startRecoveryReset(sensor_Bus->devices[slot]); }
+        }
+        sensor_Bus->clearing = false;
+    }
 }
 
 double compensateTemperature(uint32_t sensor_Temperature, uint16_t sensor_Digit_T1, int16_t sensor_Digit_T2, int16_t sensor_Dig_T3)
@@ -116,7 +871,8 @@ double compensateTemperature(uint32_t sensor_Temperature, uint16_t sensor_Digit_
     aux1 = aux1 * ((double)sensor_Digit_T2);
     aux2 = (((double)sensor_Temperature) / 131072.0 - ((double)sensor_Digit_T1) / 8192.0);
     aux2 = (aux2 * aux2) * ((double)sensor_Dig_T3);
-    return_temperature = (aux1 + aux2) / 5120.0  + sensor_Temperature_Compensation;
+    sensor_T_Fine = (int32_t)(aux1 + aux2);
+    return_temperature = (aux1 + aux2) / 5120.0  + ((double)sensor_Temperature_Compensation) / CENTIDEGREES_PER_DEGREE;
 
     if (return_temperature < min_temp){ return_temperature = min_temp; }
     else if (return_temperature > max_temp) { return_temperature = max_temp; }
@@ -124,140 +880,168 @@ double compensateTemperature(uint32_t sensor_Temperature, uint16_t sensor_Digit_
     return return_temperature;
 }
 
-void temperatureSensor()
+int32_t compensateTemperatureInteger(uint32_t sensor_Temperature, uint16_t sensor_Digit_T1, int16_t sensor_Digit_T2, int16_t sensor_Dig_T3)
 {
-    uint32_t ui32I2CMasterInterruptStatus = I2CMasterIntStatusEx(I2C2_BASE, true);
+    int32_t aux1;
+    int32_t aux2;
+    int32_t return_temperature;
+    int32_t adc_temperature = (int32_t)sensor_Temperature;
 
-    I2CMasterIntClearEx(I2C2_BASE, ui32I2CMasterInterruptStatus);
+    // Same formula of the datasheet, every shift replaces one of the double divisions
+    aux1 = ((((adc_temperature >> 3) - ((int32_t)sensor_Digit_T1 << 1))) * ((int32_t)sensor_Digit_T2)) >> 11;
+    aux2 = (adc_temperature >> 4) - ((int32_t)sensor_Digit_T1);
+    aux2 = (((aux2 * aux2) >> 12) * ((int32_t)sensor_Dig_T3)) >> 14;
+    sensor_T_Fine = aux1 + aux2;
+    return_temperature = ((sensor_T_Fine * 5 + 128) >> 8) + sensor_Temperature_Compensation;
 
-    switch(sensor_State)
-    {
-    case state_Read_Calibration:
+    if (return_temperature < TEMPERATURE_MIN_CENTIDEGREES){ return_temperature = TEMPERATURE_MIN_CENTIDEGREES; }
+    else if (return_temperature > TEMPERATURE_MAX_CENTIDEGREES) { return_temperature = TEMPERATURE_MAX_CENTIDEGREES; }
 
-        if(ui32I2CMasterInterruptStatus & I2C_MASTER_INT_NACK) { sensor_State = state_Error; }
-        else {
-            sensor_State = state_Write_Calibration;
-            I2CMasterSlaveAddrSet(I2C2_BASE, SLAVE_ADDRESS_EXT, true);
-            I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_SINGLE_RECEIVE);
-        }
+    return return_temperature;
+}
 
-        break;
-
-    case state_Write_Calibration:
-
-        if(ui32I2CMasterInterruptStatus & I2C_MASTER_INT_NACK){ sensor_State = state_Error; }
-        else {
-            sensor_Parameter_Address++;
-            sensor_Dig_Temperature[sensor_Parameter_Count] = I2CMasterDataGet(I2C2_BASE);
-            if(sensor_Parameter_Count<5)  {
-                sensor_State = state_Read_Calibration;
-                sensor_Parameter_Count++;
-                I2CMasterSlaveAddrSet(I2C2_BASE, SLAVE_ADDRESS_EXT, false);
-                I2CMasterDataPut(I2C2_BASE, sensor_Parameter_Address);
-                I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_SINGLE_SEND);
-            } else {
-                sensor_Digit_T1 = sensor_Dig_Temperature[1]<<8 | sensor_Dig_Temperature [0];
-                sensor_Digit_T2 = sensor_Dig_Temperature[3]<<8 | sensor_Dig_Temperature [2];
-                sensor_Digit_T3 = sensor_Dig_Temperature[5]<<8 | sensor_Dig_Temperature [4];
-
-                sensor_State = state_Sensor_Configuration_Finished;
-
-                I2CMasterSlaveAddrSet(I2C2_BASE, SLAVE_ADDRESS_EXT, false);
-                I2CMasterDataPut(I2C2_BASE, REGISTER_MEASCTRL);
-                I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_BURST_SEND_START);
-            }
-        }
-        break;
-
-    case state_Sensor_Configuration_Finished:
-        sensor_State = state_Adc_Status_Configuration;
-        I2CMasterDataPut(I2C2_BASE, sensor_Ctrl_Meas);
-        I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_BURST_SEND_FINISH);
-        break;
-
-    case state_Adc_Status_Configuration:
-        sensor_State = state_Adc_Status;
-        I2CMasterSlaveAddrSet(I2C2_BASE, SLAVE_ADDRESS_EXT, false);
-        I2CMasterDataPut(I2C2_BASE, REGISTER_STATUS);
-        I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_SINGLE_SEND);
-        break;
-
-    case state_Adc_Status:
-        sensor_State = state_Adc_Wait_For_Measure_Finish;
-        I2CMasterSlaveAddrSet(I2C2_BASE, SLAVE_ADDRESS_EXT, true);
-        I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_SINGLE_RECEIVE);
-        break;
-
-    case state_Adc_Wait_For_Measure_Finish :
-        if(I2CMasterDataGet(I2C2_BASE) & 0x08 == 0x08) {
-            sensor_State = state_Adc_Start_Reading;
-            I2CMasterSlaveAddrSet(I2C2_BASE, SLAVE_ADDRESS_EXT, false);
-            I2CMasterDataPut(I2C2_BASE, 0xF6);
-            I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_SINGLE_SEND);
-        } else {
-            I2CMasterSlaveAddrSet(I2C2_BASE, SLAVE_ADDRESS_EXT, true);
-            I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_SINGLE_RECEIVE);
-        }
-        break;
+uint32_t compensatePressureInteger(uint32_t adc_Pressure, const SensorCalibration* calibration)
+{
+    int32_t  aux1;
+    int32_t  aux2;
+    uint32_t pressure;
 
-    case state_Adc_Start_Reading:
+    if(adc_Pressure == SENSOR_SKIPPED_20_BITS) { return ZERO; }
 
-        if(ui32I2CMasterInterruptStatus & I2C_MASTER_INT_NACK){ sensor_State = state_Error; }
-        else {
-            sensor_State = state_Adc_Reading_In_Progress;
-            I2CMasterSlaveAddrSet(I2C2_BASE, SLAVE_ADDRESS_EXT, true);
-            I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_BURST_RECEIVE_START);
-        }
-        break;
-
-    case state_Adc_Reading_In_Progress:
-        sensor_Data_Counter++;
-        if (sensor_Data_Counter == 5){
-            sensor_ADC_Data_Temperature[0]   = I2CMasterDataGet(I2C2_BASE);
-            sensor_ADC_Data_Temperature[0] <<= 8;
-            I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_BURST_RECEIVE_FINISH);
-        } else if (sensor_Data_Counter == 6) {
-            sensor_ADC_Data_Temperature[1] =   I2CMasterDataGet(I2C2_BASE);
-            sensor_Data_Counter            =   ZERO;
-            sensor_ADC_Temperature         =   sensor_ADC_Data_Temperature[0] | sensor_ADC_Data_Temperature[1];
-            sensor_ADC_Temperature       <<=   4;
-            sensor_Temperature             =   compensateTemperature(sensor_ADC_Temperature, sensor_Digit_T1, sensor_Digit_T2, sensor_Digit_T3);
-            // Get integer values from current temperature to print
-            sensor_Current_Temperature_Integer  = (uint8_t) (sensor_Temperature + 0.05);
-            sensor_Current_Temperature_Fraction = (uint8_t) ((sensor_Temperature + 0.05) * 10);
-            sensor_Current_Temperature_Fraction = sensor_Current_Temperature_Fraction - (sensor_Current_Temperature_Integer * 10);
-            if (sensor_Current_Sample < TEMPERATURE_SAMPLES) { sensor_Temperature_Array[sensor_Current_Sample] = sensor_Temperature; }
-            else {
-                sensor_Current_Sample      = ZERO;
-                sensor_Temperature_Average = ZERO_FLOAT;
-                for(sensor_Current_Sample = ZERO; sensor_Current_Sample < TEMPERATURE_SAMPLES; sensor_Current_Sample++){
-                    sensor_Temperature_Average +=  sensor_Temperature_Array[sensor_Current_Sample];
-                }
-                sensor_Current_Sample      = ZERO;
-                sensor_Temperature_Average = sensor_Temperature_Average / (double)TEMPERATURE_SAMPLES;
-                // Update average temperature values to print
-                sensor_Avg_Temperature_Integer  = (uint8_t) (sensor_Temperature_Average + 0.05);
-                sensor_Avg_Temperature_Fraction = (uint8_t) ((sensor_Temperature_Average + 0.05) * 10);
-                sensor_Avg_Temperature_Fraction = sensor_Avg_Temperature_Fraction - (sensor_Avg_Temperature_Integer * 10);
-                if (sensor_Avg_Temperature_Fraction < 0) { sensor_Avg_Temperature_Fraction *= -1; }
-                // Update Temperature Digits to be displayed
-                sensor_Temperature_Units    = (uint8_t)sensor_Avg_Temperature_Integer % 10;
-                sensor_Temperature_Tens     = sensor_Avg_Temperature_Integer / 10;
-                sensor_Temperature_Decimals = sensor_Avg_Temperature_Fraction;
-                //Store current ADC reading so that it's not "wasted"
-                sensor_Temperature_Array[sensor_Current_Sample] = sensor_Temperature;
-            }
-            sensor_Current_Sample++;
-            if(sensor_First_Read_Flag) { sensor_First_Read_Flag = false; }
-        } else {
-            sensor_Unused_Param = I2CMasterDataGet(I2C2_BASE);
-            I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_BURST_RECEIVE_CONT);
+    // 32 bit formula of the datasheet, the result is in Pa
+    aux1 = (sensor_T_Fine >> 1) - (int32_t)64000;
+    aux2 = (((aux1 >> 2) * (aux1 >> 2)) >> 11) * ((int32_t)calibration->digitP6);
+    aux2 = aux2 + ((aux1 * ((int32_t)calibration->digitP5)) << 1);
+    aux2 = (aux2 >> 2) + (((int32_t)calibration->digitP4) << 16);
+    aux1 = (((calibration->digitP3 * (((aux1 >> 2) * (aux1 >> 2)) >> 13)) >> 3) + ((((int32_t)calibration->digitP2) * aux1) >> 1)) >> 18;
+    aux1 = ((32768 + aux1) * ((int32_t)calibration->digitP1)) >> 15;
+    // Not calibrated yet, avoids the division by zero
+    if(aux1 == ZERO) { return ZERO; }
+
+    pressure = (((uint32_t)((int32_t)1048576 - (int32_t)adc_Pressure)) - (uint32_t)(aux2 >> 12)) * 3125;
+    if(pressure < 0x80000000) { pressure = (pressure << 1) / ((uint32_t)aux1); }
+    else                      { pressure = (pressure / (uint32_t)aux1) * 2; }
+    aux1 = (((int32_t)calibration->digitP9) * ((int32_t)(((pressure >> 3) * (pressure >> 3)) >> 13))) >> 12;
+    aux2 = (((int32_t)(pressure >> 2)) * ((int32_t)calibration->digitP8)) >> 13;
+
+    return (uint32_t)((int32_t)pressure + ((aux1 + aux2 + calibration->digitP7) >> 4));
+}
+
+uint32_t compensateHumidityInteger(uint32_t adc_Humidity, const SensorCalibration* calibration)
+{
+    int32_t humidity;
+
+    if(adc_Humidity == SENSOR_SKIPPED_16_BITS) { return ZERO; }
+
+    // 32 bit formula of the datasheet, Q22.10 clamped to 0..100 %RH
+    humidity = sensor_T_Fine - (int32_t)76800;
+    humidity = (((((int32_t)adc_Humidity << 14) - (((int32_t)calibration->digitH4) << 20) - (((int32_t)calibration->digitH5) * humidity)) +
+                 (int32_t)16384) >> 15) *
+               (((((((humidity * ((int32_t)calibration->digitH6)) >> 10) * (((humidity * ((int32_t)calibration->digitH3)) >> 11) + (int32_t)32768)) >> 10) +
+                  (int32_t)2097152) * ((int32_t)calibration->digitH2) + 8192) >> 14);
+    humidity = humidity - (((((humidity >> 15) * (humidity >> 15)) >> 7) * ((int32_t)calibration->digitH1)) >> 4);
+    if(humidity < 0)         { humidity = 0; }
+    if(humidity > 419430400) { humidity = 419430400; }
+
+    return (uint32_t)(humidity >> 12);
+}
+
+void processTemperatureSamples(void)
+{
+    SensorSample       sample;
+    SensorDevice*      device;
+    SensorCalibration* calibration;
+    int32_t            average_Temperature = ZERO;
+
+    while(popTemperatureSample(&sample))
+    {
+        if(sample.lostConnection)
+        {
+            sensor_Delta_Temperature = data_Temp_LostConnection;
+            continue;
         }
-        break;
+        device      = &sensor_Devices[sample.sensor];
+        calibration = &device->calibration;
+        profilingStart(&sensor_Compensation_Cycles);
+#if SENSOR_COMPENSATION == SENSOR_COMPENSATION_DOUBLE
+        device->temperature        =   (int32_t)(compensateTemperature(sample.adcTemperature, calibration->digitT1, calibration->digitT2, calibration->digitT3) * CENTIDEGREES_PER_DEGREE);
+#else
+        device->temperature        =   compensateTemperatureInteger(sample.adcTemperature, calibration->digitT1, calibration->digitT2, calibration->digitT3);
+#endif
+        // Both take sensor_T_Fine from the temperature of the same burst
+        device->pressure           =   compensatePressureInteger(sample.adcPressure, calibration);
+        device->humidity           =   compensateHumidityInteger(sample.adcHumidity, calibration);
+        profilingStop(&sensor_Compensation_Cycles);
+        device->samples++;
+        sensor_Samples_Total++;
+        if(sensor_Sample_Callback != NULL) { sensor_Sample_Callback(device, sample.timestamp); }
+        // The other sensors only keep their last temperature
+        if(sample.sensor != SENSOR_PRIMARY) { continue; }
 
-    case state_Error:
-        GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_1, GPIO_PIN_1);
-        break;
+        sensor_ADC_Temperature = sample.adcTemperature;
+        sensor_Temperature     = device->temperature;
+        profilingStart(&sensor_Classifier_Cycles);
+        sensor_Delta_Temperature = classifyTemperature(&sensor_Statistics, sensor_Delta_Temperature, sensor_Temperature);
+        profilingStop(&sensor_Classifier_Cycles);
+        sensor_Pressure        = device->pressure;
+        sensor_Humidity        = device->humidity;
+        // Get integer values from current temperature to print, rounded to tenths
+        sensor_Current_Temperature_Integer  = (int8_t) (CENTIDEGREES_TO_TENTHS(sensor_Temperature) / 10);
+        sensor_Current_Temperature_Fraction = (int8_t) (CENTIDEGREES_TO_TENTHS(sensor_Temperature) % 10);
+        // A decimating stage of the chain may keep the sample, the average waits for its output
+        average_Temperature = sensor_Temperature;
+        if(filterProcess(sensor_Filters, sensor_Filter_Count, &average_Temperature)) {
+            average_Temperature        = updateAverage(average_Temperature);
+            sensor_Temperature_Average = average_Temperature;
+            // Update average temperature values to print
+            sensor_Avg_Temperature_Integer  = (int8_t) (CENTIDEGREES_TO_TENTHS(average_Temperature) / 10);
+            sensor_Avg_Temperature_Fraction = (int8_t) (CENTIDEGREES_TO_TENTHS(average_Temperature) % 10);
+            if (sensor_Avg_Temperature_Fraction < 0) { sensor_Avg_Temperature_Fraction *= -1; }
+            // Update Temperature Digits to be displayed
+            sensor_Temperature_Units    = (uint8_t)sensor_Avg_Temperature_Integer % 10;
+            sensor_Temperature_Tens     = sensor_Avg_Temperature_Integer / 10;
+            sensor_Temperature_Decimals = sensor_Avg_Temperature_Fraction;
+        }
+        // Time from initSensor to the first valid temperature
+        if(sensor_Startup_Cycles.samples == ZERO) { profilingStop(&sensor_Startup_Cycles); }
     }
 }
 
+bool temperatureSensor(uint8_t bus)
+{
+    uint32_t ring_Head = sensor_Sample_Ring.head;
+    bool     sample_Pushed;
+
+    profilingStart(&sensor_Isr_Cycles);
+    sensor_Interrupt_Count++;
+    sensor_Buses[bus].interrupts++;
+
+    // The sensor logic runs in the callbacks of its transactions
+    i2cEngineInterrupt(&sensor_Buses[bus].engine);
+    sample_Pushed = (ring_Head != sensor_Sample_Ring.head);
+
+#if !SENSOR_DEFERRED_PROCESSING
+    // Processing at Hwi level, only kept to measure the interrupt against the deferred one
+    if(sample_Pushed) { processTemperatureSamples(); }
+    sample_Pushed = false;
+#endif
+    profilingStop(&sensor_Isr_Cycles);
+
+    return sample_Pushed;
+}
+
+void updateSensorRate(void)
+{
+    static uint32_t last_Samples    = ZERO;
+    static uint32_t last_Interrupts = ZERO;
+    uint32_t        samples         = sensor_Samples_Total;
+    uint32_t        interrupts      = sensor_Interrupt_Count;
+
+    // Samples of all the sensors compensated in the last second
+    sensor_Samples_Per_Second = samples - last_Samples;
+    if(sensor_Samples_Per_Second != ZERO) {
+        sensor_Interrupts_Per_Sample = (interrupts - last_Interrupts) / sensor_Samples_Per_Second;
+    }
+    last_Samples    = samples;
+    last_Interrupts = interrupts;
+}
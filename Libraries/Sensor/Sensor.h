@@ -67,8 +67,13 @@
 #include "driverlib/gpio.h"
 #include "driverlib/i2c.h"
 #include "driverlib/adc.h"
+#include "driverlib/timer.h"
 #include "driverlib/interrupt.h"
 #include "driverlib/pin_map.h"
+#include "../Profiling/Profiling.h"
+#include "../Atomic/Atomic.h"
+#include "../Filter/Filter.h"
+#include "../I2cEngine/I2cEngine.h"
 
 /* *****************************************************************
  *                        Macros
@@ -80,9 +85,12 @@
 #define SYSCLOCK_SPEED (uint32_t) 120000000
 
 #define SLAVE_ADDRESS_EXT             0x76
+// SDO tied to VDDIO, second sensor of the same bus
+#define SLAVE_ADDRESS_ALT             0x77
 
 #define REGISTER_ID 0xD0
 #define REGISTER_RESET 0xE0
+#define REGISTER_CTRL_HUM 0xF2
 #define REGISTER_STATUS 0xF3
 #define REGISTER_MEASCTRL 0xF4
 #define REGISTER_CONFIG 0xF5
@@ -91,10 +99,31 @@
 #define ADDRESS_READ_TEMP_LSB 0xFB
 #define ADDRESS_READ_TEMP_XLSB 0xFC
 
+// Content of REGISTER_ID and the value that resets the sensor when written to REGISTER_RESET
+#define SENSOR_CHIP_ID 0x60
+#define SENSOR_RESET_VALUE 0xB6
+#define SENSOR_RESET_BURST_LENGTH 2
+
+// Data burst from ADDRESS_READING_START, pressure and temperature MSB/LSB/XLSB, humidity MSB/LSB
+#define SENSOR_DATA_LENGTH 8
+#define SENSOR_DATA_PRESSURE 0
+#define SENSOR_DATA_TEMPERATURE 3
+#define SENSOR_DATA_HUMIDITY 6
+
+// Value of a channel whose oversampling is off
+#define SENSOR_SKIPPED_20_BITS 0x80000
+#define SENSOR_SKIPPED_16_BITS 0x8000
+
 //Operation Modes
 #define MODE_SLEEP 0x0
 #define MODE_FORCED 0x1
 #define MODE_NORMAL 0x3
+#define MODE_MASK 0x3
+
+// ctrl_hum, sleep, config and ctrl_meas written as register/value pairs of one burst,
+// ctrl_hum only takes effect with the ctrl_meas write after it
+#define SENSOR_MODE_BURST_LENGTH 8
+#define SENSOR_CTRL_MEAS_BURST_LENGTH 2
 
 //Standby Time Temperature
 #define T_SB__5MS 0x00
@@ -103,8 +132,9 @@
 #define T_SB_250MS 0x60
 #define T_SB_500MS 0x80
 #define T_SB_1000MS 0xA0
-#define T_SB_2000MS 0xD0
+#define T_SB_2000MS 0xC0
 #define T_SB_4000MS 0xE0
+#define T_SB_MASK 0xE0
 
 //Pressure Oversampling
 #define P_OS_OFF 0x00
@@ -122,12 +152,34 @@
 #define T_OS_8 0x80
 #define T_OS_16 0xA0
 
+//Humidity Oversampling, ctrl_hum register
+#define H_OS_OFF 0x00
+#define H_OS_1 0x01
+#define H_OS_2 0x02
+#define H_OS_4 0x03
+#define H_OS_8 0x04
+#define H_OS_16 0x05
+
+// Oversampling fields of ctrl_meas and ctrl_hum
+#define OSRS_T_SHIFT 5
+#define OSRS_P_SHIFT 2
+#define OSRS_H_SHIFT 0
+#define OSRS_MASK 0x07
+#define OSRS_CODE_16 5
+
+// Maximum conversion time, 1.25 ms + 2.3 ms per sample + 0.575 ms per extra channel
+#define MEASURE_TIME_BASE_US       1250
+#define MEASURE_TIME_PER_SAMPLE_US 2300
+#define MEASURE_TIME_CHANNEL_US    575
+#define MICROSECONDS_PER_SECOND    1000000
+
 //IIR Filter
 #define IIR_OFF 0x00
 #define IIR_2 0x04
 #define IIR_4 0x08
 #define IIR_8 0x0C
 #define IIR_16 0x10
+#define IIR_MASK 0x1C
 
 //Compensation Parameters
 #define PARAM_DIG_T1_MSB 0x89
@@ -137,8 +189,40 @@
 #define PARAM_DIG_T3_MSB 0x8D
 #define PARAM_DIG_T3_LSB 0x8C
 
+// Calibration blocks, 0x88 - 0xA1 has T1..T3, P1..P9 and H1, 0xE1 - 0xE7 has H2..H6
+#define PARAM_CALIBRATION_TP_START    PARAM_DIG_T1_LSB
+#define PARAM_CALIBRATION_TP_LENGTH   26
+#define PARAM_CALIBRATION_H_START     0xE1
+#define PARAM_CALIBRATION_H_LENGTH    7
+#define SENSOR_CALIBRATION_LENGTH     (PARAM_CALIBRATION_TP_LENGTH + PARAM_CALIBRATION_H_LENGTH)
+
+// Position of every coefficient in sensor_Calibration_Data
+#define CALIBRATION_INDEX_T1          0
+#define CALIBRATION_INDEX_T2          2
+#define CALIBRATION_INDEX_T3          4
+#define CALIBRATION_INDEX_P1          6
+#define CALIBRATION_INDEX_P2          8
+#define CALIBRATION_INDEX_P3          10
+#define CALIBRATION_INDEX_P4          12
+#define CALIBRATION_INDEX_P5          14
+#define CALIBRATION_INDEX_P6          16
+#define CALIBRATION_INDEX_P7          18
+#define CALIBRATION_INDEX_P8          20
+#define CALIBRATION_INDEX_P9          22
+#define CALIBRATION_INDEX_H1          25
+#define CALIBRATION_INDEX_H2          26
+#define CALIBRATION_INDEX_H3          28
+#define CALIBRATION_INDEX_H4          29
+#define CALIBRATION_INDEX_H5          30
+#define CALIBRATION_INDEX_H6          32
+
+// Little endian coefficient of two bytes of the calibration registers of a sensor
+#define CALIBRATION_WORD(data, index) ((uint16_t)((data)[(index) + 1] << 8) | (data)[(index)])
+
 #define SLAVE_ADDRESS_EXT             0x76
 #define TEMPERATURE_SAMPLES           10
+// Longest window of the average, the window itself is chosen at runtime
+#define TEMPERATURE_SAMPLES_MAX       64
 #define ZERO                          0
 #define ZERO_FLOAT                    0.0
 #define DELTA_TEMPERATURE_UPPER_LIMIT 15
@@ -146,25 +230,216 @@
 #define MAXIMUM_STABILIZING_SAMPLES   10
 #define LOST_CONNECTION_LIMIT         10
 
+// Classifier, the delta limits are degrees between two samples. After SENSOR_STATISTICS_WINDOW
+// samples the running statistics keep that weight, an outlier is SENSOR_ANOMALY_SIGMAS away
+#define SENSOR_STATISTICS_WINDOW      64
+#define SENSOR_ANOMALY_SIGMAS         4
+#define SENSOR_MEAN_SHIFT             8
+#define SENSOR_MEAN_SCALE             (1 << SENSOR_MEAN_SHIFT)
+
+// Compensation and averaging out of the I2C2 interrupt, 0 runs them inside it as before
+#ifndef SENSOR_DEFERRED_PROCESSING
+#define SENSOR_DEFERRED_PROCESSING    1
+#endif
+
+// The uDMA empties the I2C2 RX FIFO, every read of the sensor costs one interrupt.
+// Off until the I2C2 RX channel is checked on the board, the build then gives
+// SENSOR_I2C_DMA_CHANNEL with the encoding of table 9-1 of the TM4C1294 datasheet
+#ifndef SENSOR_I2C_DMA
+#define SENSOR_I2C_DMA                0
+#endif
+
+#if SENSOR_I2C_DMA && !defined(SENSOR_I2C_DMA_CHANNEL)
+#error "SENSOR_I2C_DMA needs the verified uDMA channel of the I2C2 RX FIFO in SENSOR_I2C_DMA_CHANNEL"
+#endif
+
+// Buses of the sensors, I2C7 uses PD0/PD1 and PD1 is the MOSI of the display (SSI2XDAT0)
+#ifndef SENSOR_USE_I2C7
+#define SENSOR_USE_I2C7               0
+#endif
+
+#define SENSOR_BUS_I2C2               0
+#define SENSOR_BUS_I2C8               1
+#define SENSOR_BUS_I2C7               2
+
+#if SENSOR_USE_I2C7
+#define SENSOR_BUS_COUNT              3
+#else
+#define SENSOR_BUS_COUNT              2
+#endif
+
+// One sensor per address, 0x76 and 0x77
+#define SENSOR_MAX_PER_BUS            2
+#define SENSOR_MAX_DEVICES            (SENSOR_BUS_COUNT * SENSOR_MAX_PER_BUS)
+// Sensor of initSensor(), the only one shown on the display and averaged
+#define SENSOR_PRIMARY                0
+
+// Period of the TIMER2A tick that calls startTemperatureSample(), SYSCLOCK_SPEED / 100 cycles
+#define SENSOR_TICK_MS                10
+
+// Recovery of a failed sensor, the attempts are 1, 2, 4... ticks apart up to 2^SENSOR_RECOVERY_MAX_SHIFT.
+// A transaction that does not end in SENSOR_STUCK_TICKS is aborted
+#define SENSOR_RECOVERY_MAX_SHIFT     5
+#define SENSOR_STUCK_TICKS            5
+#ifndef SENSOR_RECOVERY_BOUND_MS
+#define SENSOR_RECOVERY_BOUND_MS      500
+#endif
+
+// Bus clear, up to 9 SCL pulses of 5 us per half period until the slave releases SDA
+#define SENSOR_BUS_CLEAR_PULSES       9
+#define SENSOR_BUS_CLEAR_DELAY        (SYSCLOCK_SPEED / 3 / 200000)
+
+// Turns the next sensor_Injected_Faults successful transactions into NACKs
+#ifndef SENSOR_FAULT_INJECTION
+#define SENSOR_FAULT_INJECTION        0
+#endif
+
+// Raw samples waiting for processTemperatureSamples(), power of two
+#define SENSOR_RING_LENGTH            8
+#define SENSOR_RING_MASK              (SENSOR_RING_LENGTH - 1)
+
+// Compensation formula of the datasheet, the integer one avoids the software
+// double routines of the M4F and gives the temperature in centi-degrees
+#define SENSOR_COMPENSATION_INTEGER   0
+#define SENSOR_COMPENSATION_DOUBLE    1
+
+#ifndef SENSOR_COMPENSATION
+#define SENSOR_COMPENSATION           SENSOR_COMPENSATION_INTEGER
+#endif
+
+// Humidity of compensateHumidityInteger() in 1/1024 %RH
+#define HUMIDITY_FRACTION_BITS        10
+
+// Limits of the sensor in centi-degrees
+#define TEMPERATURE_MIN_CENTIDEGREES  (-4000)
+#define TEMPERATURE_MAX_CENTIDEGREES  8500
+#define CENTIDEGREES_PER_DEGREE       100
+// Rounds centi-degrees to tenths, away from zero on both signs
+#define CENTIDEGREES_TO_TENTHS(centi) (((centi) < 0) ? (((centi) - 5) / 10) : (((centi) + 5) / 10))
+
 
 /* *****************************************************************
  *                       Function variables
  * *****************************************************************
  */
 
+// What the sensor is doing, the I2C sequencing is done by the I2C engine
 typedef enum
 {
     state_Read_Calibration              ,
-    state_Write_Calibration             ,
-    state_Sensor_Configuration_Finished ,
-    state_Adc_Status_Configuration      ,
-    state_Adc_Status                    ,
+    state_Write_Mode_Configuration      ,
+    state_Adc_Idle                      ,
+    state_Adc_Measure_Started           ,
     state_Adc_Wait_For_Measure_Finish   ,
-    state_Adc_Start_Reading             ,
     state_Adc_Reading_In_Progress       ,
+    state_Recovery_Clear                ,
+    state_Recovery_Reset                ,
+    state_Recovery_Startup              ,
+    state_Recovery_Check_Id             ,
     state_Error
 }BM280State;
 
+// Raw channels of one burst, the cycle count when it was read and the sensor that gave it.
+// A lost connection goes through the ring too, without channels, so the Swi sees it in order
+typedef struct
+{
+    uint32_t adcTemperature;
+    uint32_t adcPressure;
+    uint32_t adcHumidity;
+    uint32_t timestamp;
+    uint8_t  sensor;
+    bool     lostConnection;
+}SensorSample;
+
+// Coefficients of the datasheet, stored by every sensor
+typedef struct
+{
+    uint16_t digitT1;
+    int16_t  digitT2;
+    int16_t  digitT3;
+    uint16_t digitP1;
+    int16_t  digitP2;
+    int16_t  digitP3;
+    int16_t  digitP4;
+    int16_t  digitP5;
+    int16_t  digitP6;
+    int16_t  digitP7;
+    int16_t  digitP8;
+    int16_t  digitP9;
+    uint8_t  digitH1;
+    int16_t  digitH2;
+    uint8_t  digitH3;
+    int16_t  digitH4;
+    int16_t  digitH5;
+    int8_t   digitH6;
+}SensorCalibration;
+
+// One BME280, its own state machine and transactions so sensors of every bus sample in parallel
+typedef struct
+{
+    uint8_t             address;
+    uint8_t             index;
+    uint8_t             bus;
+    volatile BM280State state;
+    bool                modeUpdate;
+    bool                calibrated;
+    bool                recovering;
+    bool                lostConnection;
+    uint8_t             recoveryAttempts;
+    uint8_t             backoffTicks;
+    uint8_t             stuckTicks;
+    uint8_t             chipId;
+    uint8_t             resetBurst[SENSOR_RESET_BURST_LENGTH];
+    uint8_t             calibrationData[SENSOR_CALIBRATION_LENGTH];
+    uint8_t             adcData[SENSOR_DATA_LENGTH];
+    uint8_t             modeBurst[SENSOR_MODE_BURST_LENGTH];
+    uint8_t             ctrlMeasBurst[SENSOR_CTRL_MEAS_BURST_LENGTH];
+    SensorCalibration   calibration;
+    int32_t             temperature;
+    uint32_t            pressure;
+    uint32_t            humidity;
+    uint32_t            samples;
+    uint32_t            errors;
+    uint32_t            faultTick;
+    uint32_t            recoveryMs;
+    I2cTransaction      resetWrite;
+    I2cTransaction      idRead;
+    I2cTransaction      calibrationTPRead;
+    I2cTransaction      calibrationHRead;
+    I2cTransaction      modeWrite;
+    I2cTransaction      ctrlMeasWrite;
+    I2cTransaction      measurementRead;
+}SensorDevice;
+
+// One I2C module, next rotates the sensor that is queued first on every sample
+typedef struct
+{
+    I2cEngine           engine;
+    SensorDevice*       devices[SENSOR_MAX_PER_BUS];
+    volatile uint8_t    count;
+    uint8_t             next;
+    uint32_t            interrupts;
+    // The Swi clears the bus and resets the module, the tick and TIMER3 leave it alone
+    volatile bool       clearing;
+}SensorBus;
+
+// A reserved slot is only read once its producer marked it ready
+typedef struct
+{
+    SensorSample        sample;
+    volatile bool       ready;
+}SensorSampleSlot;
+
+// Producers are the interrupts of every I2C bus, they reserve slots moving head with a
+// compare and swap. Single consumer (Swi) moves tail, head and tail only grow
+typedef struct
+{
+    SensorSampleSlot    slots[SENSOR_RING_LENGTH];
+    volatile uint32_t   head;
+    volatile uint32_t   tail;
+    volatile uint32_t   overflows;
+}SensorSampleRing;
+
 typedef enum
 {
     data_Temp_Normal      ,
@@ -173,34 +448,71 @@ typedef enum
     data_Temp_LostConnection
 }DetaTemperatureStatus;
 
-extern bool     sensor_First_Read_Flag;
+// Running mean (centi-degrees << SENSOR_MEAN_SHIFT) and variance (centi-degrees^2) of the classifier,
+// previous is the last accepted sample and rejected the last abnormal one
+typedef struct
+{
+    int32_t  meanQ8;
+    int32_t  variance;
+    int32_t  previous;
+    int32_t  rejected;
+    uint16_t count;
+    uint8_t  calmSamples;
+}SensorStatistics;
+
+// Called by processTemperatureSamples() for every compensated sample, timestamp in cycles of the read
+typedef void (*SensorSampleCallback)(const SensorDevice* device, uint32_t timestamp);
+
 extern uint8_t  sensor_Temperature_Units            ;
 extern uint8_t  sensor_Temperature_Tens             ;
 extern uint8_t  sensor_Temperature_Decimals         ;
 extern uint8_t  sensor_Ctrl_Meas                    ;
-extern uint8_t  sensor_Parameter_Address            ;
-extern uint8_t  sensor_Parameter_Count              ;
-extern uint8_t  sensor_Data_Counter                 ;
+extern uint8_t  sensor_Config                       ;
+extern uint8_t  sensor_Ctrl_Hum                     ;
 extern uint8_t  sensor_Current_Sample               ;
+extern uint8_t  sensor_Window_Length                ;
+extern volatile uint8_t sensor_Window_Request       ;
+extern uint8_t  sensor_Window_Count                 ;
+extern int32_t  sensor_Temperature_Sum              ;
 extern int8_t   sensor_Avg_Temperature_Integer      ;
 extern int8_t   sensor_Avg_Temperature_Fraction     ;
 extern int8_t   sensor_Current_Temperature_Integer  ;
 extern int8_t   sensor_Current_Temperature_Fraction ;
-extern uint16_t sensor_Digit_T1                     ;
-extern int16_t  sensor_Digit_T2                     ;
-extern int16_t  sensor_Digit_T3                     ;
-extern uint16_t sensor_Unused_Param                 ;
 extern uint32_t sensor_ADC_Temperature              ;
-extern double   sensor_Temperature                  ;
-extern double   sensor_Temperature_Average          ;
+extern int32_t  sensor_Temperature                  ;
+extern uint32_t sensor_Pressure                     ;
+extern uint32_t sensor_Humidity                     ;
+extern int32_t  sensor_T_Fine                       ;
+extern uint32_t sensor_Measure_Time                 ;
+extern uint32_t sensor_Interrupt_Count              ;
+extern uint32_t sensor_Interrupts_Per_Sample        ;
+extern uint32_t sensor_Samples_Total                ;
+extern uint32_t sensor_Samples_Per_Second           ;
+extern volatile uint8_t sensor_Device_Count         ;
+extern uint32_t sensor_Tick_Count                   ;
+extern uint32_t sensor_Recovery_Ms_Max              ;
+extern uint32_t sensor_Recovery_Over_Bound          ;
+extern volatile uint8_t sensor_Injected_Faults      ;
+extern volatile bool    sensor_Streaming            ;
+extern int32_t  sensor_Temperature_Average          ;
 
-extern uint8_t                 sensor_Dig_Temperature[6]                             ;
-extern volatile uint16_t       sensor_ADC_Data_Temperature[2]                        ;
 extern float                   sensor_Temperature_Array_ADC[TEMPERATURE_SAMPLES]     ;
-extern double                  sensor_Temperature_Array[TEMPERATURE_SAMPLES]         ;
-extern double                  sensor_Temperature_Compensation                       ;
-extern BM280State              sensor_State                                          ;
-extern DetaTemperatureStatus   sensor_Delta_Temperature                              ;
+extern int32_t                 sensor_Temperature_Array[TEMPERATURE_SAMPLES_MAX]     ;
+extern int32_t                 sensor_Temperature_Compensation                       ;
+extern ProfilingCounter        sensor_Compensation_Cycles                            ;
+extern ProfilingCounter        sensor_Startup_Cycles                                 ;
+extern ProfilingCounter        sensor_Bus_Cycles                                     ;
+extern ProfilingCounter        sensor_Sample_Cycles                                  ;
+extern ProfilingCounter        sensor_Isr_Cycles                                     ;
+extern ProfilingCounter        sensor_Classifier_Cycles                              ;
+extern SensorStatistics        sensor_Statistics                                     ;
+extern SensorSampleRing        sensor_Sample_Ring                                    ;
+extern SensorDevice            sensor_Devices[SENSOR_MAX_DEVICES]                    ;
+extern SensorBus               sensor_Buses[SENSOR_BUS_COUNT]                        ;
+extern FilterStage             sensor_Filters[FILTER_MAX_STAGES]                     ;
+extern volatile uint8_t        sensor_Filter_Count                                   ;
+extern volatile DetaTemperatureStatus sensor_Delta_Temperature                       ;
+extern SensorSampleCallback    sensor_Sample_Callback                                ;
 
 /* *****************************************************************
  *                       Function prototypes
@@ -218,7 +530,7 @@ extern DetaTemperatureStatus   sensor_Delta_Temperature
 *  @endcode
 *
 *  @note
-*      N/A
+*      Starts every bus and adds the sensor of SLAVE_ADDRESS_EXT on I2C2 as SENSOR_PRIMARY
 *
 ******************************************************************************
 */
@@ -228,38 +540,226 @@ void initSensor(void);
 /**
 *****************************************************************************
 *
-*  @brief Initialize all related registers to use in the ADC0
+*  @brief Adds one more sensor, its calibration and configuration are queued on its bus
+*
+*  @param[in]   bus         SENSOR_BUS_I2C2, SENSOR_BUS_I2C8 or SENSOR_BUS_I2C7
+*  @param[in]   address     SLAVE_ADDRESS_EXT or SLAVE_ADDRESS_ALT
 *
 *  @b example
 *  @code
-*      void initSensor();
+*      addSensor(SENSOR_BUS_I2C8, SLAVE_ADDRESS_EXT);
+*  @endcode
+*
+*  @note
+*      Returns false when the bus is full or already has the address. The sensor
+*      samples with the others once it is configured
+*
+******************************************************************************
+*/
+
+bool addSensor(uint8_t bus, uint8_t address);
+
+/**
+*****************************************************************************
+*
+*  @brief Selects forced or normal mode, the standby time and the IIR filter of the sensor
+*
+*  @param[in]   mode        MODE_FORCED or MODE_NORMAL
+*  @param[in]   standby     One of the T_SB_* values, only used in normal mode
+*  @param[in]   filter      One of the IIR_* values
+*
+*  @b example
+*  @code
+*      configureSensorMode(MODE_NORMAL, T_SB_62_5MS, IIR_OFF);
+*  @endcode
+*
+*  @note
+*      Every sensor is reconfigured at the start of its next sample
+*
+******************************************************************************
+*/
+
+void configureSensorMode(uint8_t mode, uint8_t standby, uint8_t filter);
+
+/**
+*****************************************************************************
+*
+*  @brief Starts one temperature sample of every idle sensor, the rest of it runs in the I2C interrupts
+*
+*  @b example
+*  @code
+*      if(startTemperatureSample()) { Swi_post(sensorSwi); }
+*  @endcode
+*
+*  @note
+*      Forced mode writes ctrl_meas and waits the conversion time, normal mode only reads the data.
+*      A sensor still busy with its last sample is skipped, a failed one is recovered with bus clear,
+*      soft reset and chip ID check. Must be called every SENSOR_TICK_MS. Returns true when a bus
+*      waits for recoverSensorBuses() or an aborted transaction left a lost connection in the ring
+*
+******************************************************************************
+*/
+
+bool startTemperatureSample(void);
+
+/**
+*****************************************************************************
+*
+*  @brief Clears the buses of the failed sensors and resets their I2C modules
+*
+*  @b example
+*  @code
+*      void recoverSensorBuses();
+*  @endcode
+*
+*  @note
+*      Bit-bangs up to SENSOR_BUS_CLEAR_PULSES clock pulses with busy waits, so it runs in the Swi and
+*      not in the tick. Then sends the soft reset, the next ticks check the chip ID
+*
+******************************************************************************
+*/
+
+void recoverSensorBuses(void);
+
+/**
+*****************************************************************************
+*
+*  @brief Starts the filter chain with the first stages of sensor_Filters
+*
+*  @param[in]   count       Stages used, 0 to FILTER_MAX_STAGES
+*
+*  @b example
+*  @code
+*      sensor_Filters[0].type      = filter_Ema;
+*      sensor_Filters[0].parameter = 3;
+*      setTemperatureFilters(1);
+*  @endcode
+*
+*  @note
+*      A filter_Sensor_Iir stage programs its IIR_* code in the sensor with the next sample
+*
+******************************************************************************
+*/
+
+void setTemperatureFilters(uint8_t count);
+
+/**
+*****************************************************************************
+*
+*  @brief Changes the number of samples of the temperature average
+*
+*  @param[in]   length      Samples in the window, 1 to TEMPERATURE_SAMPLES_MAX
+*
+*  @b example
+*  @code
+*      setTemperatureWindow(TEMPERATURE_SAMPLES);
+*  @endcode
+*
+*  @note
+*      The average restarts with the next sample, out of range lengths are clamped
+*
+******************************************************************************
+*/
+
+void setTemperatureWindow(uint8_t length);
+
+/**
+*****************************************************************************
+*
+*  @brief Samples every sensor as fast as it converts, for the characterisation runs
+*
+*  @param[in]   enable      true starts the streaming, false goes back to the previous mode
+*
+*  @b example
+*  @code
+*      sensorSetStreaming(true);
+*  @endcode
+*
+*  @note
+*      The sensors go to forced mode and every read starts the next conversion, the rate
+*      is set by the oversampling in sensor_Ctrl_Meas and sensor_Ctrl_Hum. The TIMER2 tick
+*      only restarts a sensor that stopped
+*
+******************************************************************************
+*/
+
+void sensorSetStreaming(bool enable);
+
+/**
+*****************************************************************************
+*
+*  @brief Ends the conversion wait of forced mode and reads the temperature
+*
+*  @b example
+*  @code
+*      void sensorMeasureTimeout();
+*  @endcode
+*
+*  @note
+*      Called by the TIMER3A interrupt, armed for sensor_Measure_Time microseconds after the
+*      last ctrl_meas write of any bus, every sensor waiting is read
+*
+******************************************************************************
+*/
+
+void sensorMeasureTimeout(void);
+
+/**
+*****************************************************************************
+*
+*  @brief Interrupt of the I2C module of a bus, runs its I2C engine and the sensor callbacks
+*
+*  @param[in]   bus         Bus of the interrupt, SENSOR_BUS_I2C2 for example
+*
+*  @b example
+*  @code
+*      if(temperatureSensor(SENSOR_BUS_I2C2)) { Swi_post(sensorSwi); }
 *  @endcode
 *
 *  @note
-*      N/A
+*      Returns true when a raw sample was left for processTemperatureSamples()
 *
 ******************************************************************************
 */
 
-void initADC0(void);
+bool temperatureSensor(uint8_t bus);
 
 /**
 *****************************************************************************
 *
-*  @brief Function of the Sensor BM280 with all the states to get the Temperature
+*  @brief Updates sensor_Samples_Per_Second and sensor_Interrupts_Per_Sample of all the sensors
 *
 *  @b example
 *  @code
-*      void temperatureSensor();
+*      void updateSensorRate();
 *  @endcode
 *
 *  @note
-*      N/A
+*      Must be called once per second
 *
 ******************************************************************************
 */
 
-void temperatureSensor(void);
+void updateSensorRate(void);
+
+/**
+*****************************************************************************
+*
+*  @brief Compensates, classifies, filters and averages every raw sample waiting in the ring
+*
+*  @b example
+*  @code
+*      void processTemperatureSamples();
+*  @endcode
+*
+*  @note
+*      Must not preempt itself, it is the only consumer of sensor_Sample_Ring.
+*      sensor_Delta_Temperature follows the samples of SENSOR_PRIMARY
+*
+******************************************************************************
+*/
+
+void processTemperatureSamples(void);
 
 /**
 *****************************************************************************
@@ -278,11 +778,104 @@ void temperatureSensor(void);
 *  @endcode
 *
 *  @note
-*      N/A
+*      Updates sensor_T_Fine like compensateTemperatureInteger()
 *
 ******************************************************************************
 */
 
 double compensateTemperature(uint32_t sensor_Temperature, uint16_t sensor_Digit_T1, int16_t sensor_Digit_T2, int16_t sensor_Digit_T3);
 
+/**
+*****************************************************************************
+*
+*  @brief This function compensated the temperature captured by the I2C protocol with the
+*         32 bit integer formula provided by the manufacturer
+*
+*  @param[in]   sensor_Temperature    Temperature value obtained in ADC, 20 bits
+*  @param[in]   sensor_Digit_T1       Compensation value 1 generated from calibration
+*  @param[in]   sensor_Digit_T2       Compensation value 2 generated from calibration
+*  @param[in]   sensor_Digit_T3       Compensation value 3 generated from calibration
+*
+*  @b example
+*  @code
+*      int32_t centiDegrees = compensateTemperatureInteger(sensor_ADC_Temperature, sensor_Digit_T1, sensor_Digit_T2, sensor_Digit_T3);
+*  @endcode
+*
+*  @note
+*      Returns centi-degrees, 2534 is 25.34 degrees. Updates sensor_T_Fine that
+*      the pressure and humidity formulas need
+*
+******************************************************************************
+*/
+
+int32_t compensateTemperatureInteger(uint32_t sensor_Temperature, uint16_t sensor_Digit_T1, int16_t sensor_Digit_T2, int16_t sensor_Digit_T3);
+
+/**
+*****************************************************************************
+*
+*  @brief Compensates the pressure with the 32 bit integer formula provided by the manufacturer
+*
+*  @param[in]   adc_Pressure    Pressure value obtained in ADC, 20 bits
+*  @param[in]   calibration     Coefficients of the sensor that read it
+*
+*  @b example
+*  @code
+*      uint32_t pascals = compensatePressureInteger(sample.adcPressure, &device->calibration);
+*  @endcode
+*
+*  @note
+*      Returns Pa, 0 when the channel is off. Uses the sensor_T_Fine of the temperature
+*      of the same burst, it must be compensated first
+*
+******************************************************************************
+*/
+
+uint32_t compensatePressureInteger(uint32_t adc_Pressure, const SensorCalibration* calibration);
+
+/**
+*****************************************************************************
+*
+*  @brief Classifies one compensated temperature against the running statistics of the stable ones
+*
+*  @param[in]   statistics      Running mean and variance, updated with the accepted samples
+*  @param[in]   status          Status given to the previous sample
+*  @param[in]   temperature     Sample in centi-degrees
+*
+*  @b example
+*  @code
+*      sensor_Delta_Temperature = classifyTemperature(&sensor_Statistics, sensor_Delta_Temperature, sensor_Temperature);
+*  @endcode
+*
+*  @note
+*      Returns the status of the sample. An abnormal sample stays out of the statistics and of the
+*      step of the next one, the status ends when a sample is back near the last accepted one or
+*      two in a row agree on a new level
+*
+******************************************************************************
+*/
+
+DetaTemperatureStatus classifyTemperature(SensorStatistics* statistics, DetaTemperatureStatus status, int32_t temperature);
+
+/**
+*****************************************************************************
+*
+*  @brief Compensates the humidity with the 32 bit integer formula provided by the manufacturer
+*
+*  @param[in]   adc_Humidity    Humidity value obtained in ADC, 16 bits
+*  @param[in]   calibration     Coefficients of the sensor that read it
+*
+*  @b example
+*  @code
+*      uint32_t humidity = compensateHumidityInteger(sample.adcHumidity, &device->calibration);
+*  @endcode
+*
+*  @note
+*      Returns %RH with HUMIDITY_FRACTION_BITS of fraction, 47445 is 46.333 %RH. 0 when
+*      the channel is off. Uses sensor_T_Fine like compensatePressureInteger()
+*
+******************************************************************************
+*/
+
+uint32_t compensateHumidityInteger(uint32_t adc_Humidity, const SensorCalibration* calibration);
+
 #endif /* LIBRARIES_SENSOR_SENSOR_H_ */
@@ -0,0 +1,157 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Telemetry.c
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    The purpose of this C language file is to pack and frame the
+    binary telemetry records.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    This source file is going to calculate the CRC and the COBS framing of
+    the records, with defines in header Telemetry.h.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#include "Telemetry.h"
+
+// CRC of every nibble shifted out of the high part of the register
+static const uint16_t telemetry_Crc_Table[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+uint16_t telemetryCrc16(const uint8_t* data, uint16_t length)
+{
+    uint16_t crc = TELEMETRY_CRC_INITIAL;
+
+    while(length-- > 0)
+    {
+        crc = (uint16_t)(crc << 4) ^ telemetry_Crc_Table[(crc >> 12) ^ (*data >> 4)];
+        crc = (uint16_t)(crc << 4) ^ telemetry_Crc_Table[(crc >> 12) ^ (*data & 0x0F)];
+        data++;
+    }
+    return crc;
+}
+
+static void telemetryPut16(uint8_t* data, uint16_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+}
+
+static void telemetryPut32(uint8_t* data, uint32_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+    data[2] = (uint8_t)(value >> 16);
+    data[3] = (uint8_t)(value >> 24);
+}
+
+// Every 0x00 becomes the distance to the next one, the blocks are shorter than 254 bytes
+static uint8_t telemetryFrame(uint8_t* frame, const uint8_t* raw, uint8_t rawLength)
+{
+    uint8_t index;
+    uint8_t code_Index = 0;
+    uint8_t length     = 1;
+
+    for(index = 0; index < rawLength; index++)
+    {
+        if(raw[index] == 0)
+        {
+            frame[code_Index] = (uint8_t)(length - code_Index);
+            code_Index = length++;
+        }
+        else
+        {
+            frame[length++] = raw[index];
+        }
+    }
+    frame[code_Index] = (uint8_t)(length - code_Index);
+    frame[length++]   = TELEMETRY_FRAME_DELIMITER;
+    return length;
+}
+
+uint8_t telemetryEncode(uint8_t* frame, const TelemetryRecord* record)
+{
+    // Off the stack of the Swi, the callers share one Swi priority
+    static uint8_t raw[TELEMETRY_RECORD_LENGTH];
+
+    telemetryPut16(&raw[0], record->sequence);
+    telemetryPut32(&raw[2], record->timestamp);
+    raw[6] = record->channel;
+    telemetryPut32(&raw[7], (uint32_t)record->value);
+    telemetryPut16(&raw[TELEMETRY_CRC_OFFSET], telemetryCrc16(raw, TELEMETRY_CRC_OFFSET));
+
+    return telemetryFrame(frame, raw, TELEMETRY_RECORD_LENGTH);
+}
+
+uint8_t telemetryEncodeStream(uint8_t* frame, const TelemetryStream* stream)
+{
+    static uint8_t raw[TELEMETRY_STREAM_LENGTH(TELEMETRY_STREAM_SAMPLES_MAX)];
+    uint8_t count  = stream->count;
+    uint8_t length = TELEMETRY_STREAM_HEADER_LENGTH;
+    uint8_t index;
+
+    if(count == 0) { count = 1; }
+    else if(count > TELEMETRY_STREAM_SAMPLES_MAX) { count = TELEMETRY_STREAM_SAMPLES_MAX; }
+
+    telemetryPut16(&raw[0], stream->sequence);
+    telemetryPut32(&raw[2], stream->timestamp);
+    raw[6] = stream->sensor;
+    raw[7] = count;
+    telemetryPut16(&raw[8], stream->dropped);
+    for(index = 0; index < count; index++)
+    {
+        telemetryPut16(&raw[length], stream->samples[index].offset);
+        telemetryPut16(&raw[length + 2], (uint16_t)stream->samples[index].temperature);
+        telemetryPut16(&raw[length + 4], stream->samples[index].humidity);
+        telemetryPut32(&raw[length + 6], stream->samples[index].pressure);
+        length += TELEMETRY_STREAM_SAMPLE_LENGTH;
+    }
+    telemetryPut16(&raw[length], telemetryCrc16(raw, length));
+    length += 2;
+
+    return telemetryFrame(frame, raw, length);
+}
+
+// End of file
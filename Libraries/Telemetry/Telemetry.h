@@ -0,0 +1,219 @@
+/* Project Documentation
+  @Company
+    Universidad Tecnologica de Queretaro - Visteon
+
+  @Project Name
+  ProyetoFinalDisplayV4
+
+  @File Name
+    Telemetry.h
+
+  @Author
+    Romero, Rodrigo
+    Olvera, Diego
+    Perches, Gibran
+
+  @Summary
+    This is the a header file for C language. The purpose is to
+    pack the telemetry in binary records for the UART.
+
+  @Date
+  17/10/2026
+
+  @Version
+  V4.0
+
+  @Description
+    A record carries a sequence number, a timestamp, a channel and a fixed
+    point value, closed by a CRC-16. A stream frame carries a batch of
+    samples of one sensor instead. Every frame is framed with COBS, so the
+    only 0x00 on the line is the end of a frame. It does not use the hardware,
+    the decoder of the host in Host/Telemetry compiles it too.
+
+
+    Generation Information :
+        Product Revision  :  TM4C129EXL - 1.168.0
+        Device            :  TM4C129ENCPDT
+    The generated drivers are tested against the following:
+        Languaje          :  C ANSI C 89 Mode
+        Compiler          :  TIv16.9.6LTS
+        CCS               :  CCS v7.4.0.00015
+*/
+
+/*
+    (c) 2022 Romero Rodrigo, OlveraDiego, Perches Gibran. You may use this
+    software and any derivatives exclusively with Texas Instruments products.
+
+    THIS SOFTWARE IS SUPPLIED BY Romero Rodrigo, Olvera Diego, Perches Gibran "AS IS".
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+    ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+    PARTICULAR PURPOSE, OR ITS INTERACTION WITH TEXAS INSTRUMENTS PRODUCTS, COMBINATION
+    WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+
+    Romero Rodrigo, Olvera Diego, Perches Gibran PROVIDES THIS SOFTWARE CONDITIONALLY UPON
+    YOUR ACCEPTANCE OF THESE TERMS.
+*/
+
+#ifndef LIBRARIES_TELEMETRY_TELEMETRY_H_
+#define LIBRARIES_TELEMETRY_TELEMETRY_H_
+
+/* *****************************************************************
+ *                        Included files
+ * *****************************************************************
+ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* *****************************************************************
+ *                        Macros
+ * *****************************************************************
+ */
+
+// sequence(2) timestamp(4) channel(1) value(4) crc(2), little endian
+#define TELEMETRY_RECORD_LENGTH     13
+#define TELEMETRY_CRC_OFFSET        (TELEMETRY_RECORD_LENGTH - 2)
+
+// COBS adds one byte up to 254 bytes of data, plus the 0x00 delimiter
+#define TELEMETRY_FRAME_LENGTH      (TELEMETRY_RECORD_LENGTH + 2)
+#define TELEMETRY_FRAME_DELIMITER   0x00
+
+// sequence(2) timestamp(4) sensor(1) count(1) dropped(2), then the samples and the crc(2)
+#define TELEMETRY_STREAM_HEADER_LENGTH  10
+// offset(2) temperature(2) humidity(2) pressure(4) of every sample
+#define TELEMETRY_STREAM_SAMPLE_LENGTH  10
+#define TELEMETRY_STREAM_SAMPLES_MAX    10
+// Unit of the offset of a sample, 16 bits cover 655 ms
+#define TELEMETRY_STREAM_OFFSET_US      10
+#define TELEMETRY_STREAM_LENGTH(count)  (TELEMETRY_STREAM_HEADER_LENGTH + (count) * TELEMETRY_STREAM_SAMPLE_LENGTH + 2)
+// The biggest frame, always under the 254 bytes of a COBS block
+#define TELEMETRY_STREAM_FRAME_LENGTH   (TELEMETRY_STREAM_LENGTH(TELEMETRY_STREAM_SAMPLES_MAX) + 2)
+
+// CRC-16/CCITT-FALSE
+#define TELEMETRY_CRC_INITIAL       0xFFFF
+#define TELEMETRY_CRC_POLYNOMIAL    0x1021
+
+/* *****************************************************************
+ *                       Data types
+ * *****************************************************************
+ */
+
+typedef enum
+{
+    telemetry_Mode_Text     ,
+    telemetry_Mode_Binary   ,
+    telemetry_Mode_Stream
+}TelemetryMode;
+
+// Units of the value of every channel
+typedef enum
+{
+    telemetry_Channel_Temperature       ,   // Centi-degrees, average of the sensor
+    telemetry_Channel_Pressure          ,   // Pa
+    telemetry_Channel_Humidity          ,   // %RH with HUMIDITY_FRACTION_BITS of fraction
+    telemetry_Channel_Die_Temperature   ,   // Centi-degrees, internal ADC
+    telemetry_Channel_Count
+}TelemetryChannel;
+
+typedef struct
+{
+    uint16_t sequence;
+    uint32_t timestamp;     // Milliseconds
+    uint8_t  channel;
+    int32_t  value;
+}TelemetryRecord;
+
+// Offset from the first sample in TELEMETRY_STREAM_OFFSET_US units, humidity in centi-%RH
+typedef struct
+{
+    uint16_t offset;
+    int16_t  temperature;
+    uint16_t humidity;
+    uint32_t pressure;
+}TelemetrySample;
+
+// Record lengths never match a stream length, the decoder tells them apart by size
+typedef struct
+{
+    uint16_t        sequence;
+    uint32_t        timestamp;      // Cycles of SYSCLOCK of the first sample
+    uint8_t         sensor;
+    uint8_t         count;
+    uint16_t        dropped;        // Samples lost before this frame
+    TelemetrySample samples[TELEMETRY_STREAM_SAMPLES_MAX];
+}TelemetryStream;
+
+/* *****************************************************************
+ *                       Function prototypes
+ * *****************************************************************
+ */
+
+/**
+*****************************************************************************
+*
+*  @brief Calculates the CRC-16/CCITT-FALSE of a block
+*
+*  @param[in]   data        Bytes of the block
+*  @param[in]   length      Number of bytes
+*
+*  @return      CRC of the block, 0x29B1 for "123456789"
+*
+*  @b example
+*  @code
+*      crc = telemetryCrc16(record, TELEMETRY_CRC_OFFSET);
+*  @endcode
+*
+*  @note
+*      A table of 16 entries, one nibble per step
+*
+******************************************************************************
+*/
+
+uint16_t telemetryCrc16(const uint8_t* data, uint16_t length);
+
+/**
+*****************************************************************************
+*
+*  @brief Packs a record with its CRC and frames it with COBS
+*
+*  @param[out]  frame       Destination, TELEMETRY_FRAME_LENGTH bytes
+*  @param[in]   record      Record to be sent
+*
+*  @return      Number of bytes of the frame, delimiter included
+*
+*  @b example
+*  @code
+*      lineLength += telemetryEncode((uint8_t*)&line[lineLength], &record);
+*  @endcode
+*
+*  @note
+*      Not reentrant, the packed record is static
+*
+******************************************************************************
+*/
+
+uint8_t telemetryEncode(uint8_t* frame, const TelemetryRecord* record);
+
+/**
+*****************************************************************************
+*
+*  @brief Packs a batch of samples with its CRC and frames it with COBS
+*
+*  @param[out]  frame       Destination, TELEMETRY_STREAM_FRAME_LENGTH bytes
+*  @param[in]   stream      Batch to be sent, count from 1 to TELEMETRY_STREAM_SAMPLES_MAX
+*
+*  @return      Number of bytes of the frame, delimiter included
+*
+*  @b example
+*  @code
+*      frameLength = telemetryEncodeStream(frame, &stream);
+*  @endcode
+*
+*  @note
+*      A count out of range is clamped. Not reentrant, the packed batch is static
+*
+******************************************************************************
+*/
+
+uint8_t telemetryEncodeStream(uint8_t* frame, const TelemetryStream* stream);
+
+#endif /* LIBRARIES_TELEMETRY_TELEMETRY_H_ */
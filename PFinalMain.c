@@ -99,6 +99,7 @@
 /* BIOS Header files */
 #include <ti/sysbios/BIOS.h>
 #include <ti/sysbios/knl/Task.h>
+#include <ti/sysbios/knl/Swi.h>
 #include <ti/sysbios/hal/Hwi.h>
 #include <inc/hw_ints.h>
 
@@ -107,8 +108,10 @@
 
 #include "Libraries/Display/Display.h"
 #include "Libraries/Buttons/Buttons.h"
-#include "Libraries/Rs232/Rs232.h"
+#include "Libraries/RS232/Rs232.h"
 #include "Libraries/Sensor/Sensor.h"
+#include "Libraries/Adc/Adc.h"
+#include "Libraries/Profiling/Profiling.h"
 
 /* Board Header file */
 #include "Board.h"
@@ -136,10 +139,16 @@
 #undef SECONDS_MAX_VALUE
 #define SECONDS_MAX_VALUE 60
 
-Task_Struct taskSMStruct, taskADCStruct;
+// Telemetry of UART0 from the boot, telemetry_Mode_Stream for the characterisation
+// runs where the host opens the port at UART_SPEED_STREAM
+#ifndef TELEMETRY_BOOT_MODE
+#define TELEMETRY_BOOT_MODE telemetry_Mode_Text
+#endif
+
+Task_Struct taskSMStruct;
 Char taskSMStack[TASKSTACKSIZE];
-Char taskADCStack[TASKSTACKSIZE];
-Hwi_Handle timer1AHwi, timer2AHwi, I2C2Hwi;
+Hwi_Handle timer1AHwi, timer2AHwi, timer3AHwi, I2C2Hwi, I2C8Hwi, I2C7Hwi, SSI2Hwi, ADC0Hwi, ADC0AlarmHwi, UART0Hwi;
+Swi_Handle sensorSwi, telemetrySwi;
 
 /**
 *****************************************************************************
@@ -161,7 +170,7 @@ Void stateMachine(UArg arg0, UArg arg1);
 /**
 *****************************************************************************
 *
-*  @brief Task to obtain the internal temperature of the micro
+*  @brief Interrupt routine for the Timer1A
 *
 *  @b example
 *  @code
@@ -173,12 +182,12 @@ Void stateMachine(UArg arg0, UArg arg1);
 *
 ******************************************************************************
 */
-Void ADC0Fxn(UArg arg0, UArg arg1);
+Void timer1AHwInt(UArg arg);
 
 /**
 *****************************************************************************
 *
-*  @brief Interrupt routine for the Timer1A
+*  @brief Interrupt routine for the Timer2A
 *
 *  @b example
 *  @code
@@ -190,12 +199,12 @@ Void ADC0Fxn(UArg arg0, UArg arg1);
 *
 ******************************************************************************
 */
-Void timer1AHwInt(UArg arg);
+Void timer2AHwInt(UArg arg);
 
 /**
 *****************************************************************************
 *
-*  @brief Interrupt routine for the Timer2A
+*  @brief Interrupt routine for the Timer3A, end of the sensor conversion
 *
 *  @b example
 *  @code
@@ -207,12 +216,133 @@ Void timer1AHwInt(UArg arg);
 *
 ******************************************************************************
 */
-Void timer2AHwInt(UArg arg);
+Void timer3AHwInt(UArg arg);
+
+/**
+*****************************************************************************
+*
+*  @brief Interrupt routine for the I2C modules of the sensors
+*
+*  @b example
+*  @code
+*      N/A
+*  @endcode
+*
+*  @note
+*      arg is the SENSOR_BUS_* index of the module
+*
+******************************************************************************
+*/
+Void i2cSensorHwi(UArg arg);
+
+/**
+*****************************************************************************
+*
+*  @brief Software interrupt that processes the samples left by the I2C2 interrupt
+*
+*  @b example
+*  @code
+*      N/A
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+Void sensorSwiFxn(UArg arg0, UArg arg1);
+
+/**
+*****************************************************************************
+*
+*  @brief Software interrupt that writes the telemetry of every second
+*
+*  @b example
+*  @code
+*      N/A
+*  @endcode
+*
+*  @note
+*      Posted by timer1AHwInt, a text line or the binary records of uart_Telemetry_Mode
+*      only go to the ring of the UART
+*
+******************************************************************************
+*/
+Void telemetrySwiFxn(UArg arg0, UArg arg1);
+
+/**
+*****************************************************************************
+*
+*  @brief Interrupt routine for the UART0 transmission
+*
+*  @b example
+*  @code
+*      N/A
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+Void uart0Hwi(UArg arg);
+
+/**
+*****************************************************************************
+*
+*  @brief Adds a compensated sample to the batch of its sensor, sends the full batches
+*
+*  @b example
+*  @code
+*      N/A
+*  @endcode
+*
+*  @note
+*      sensor_Sample_Callback of the streaming mode, runs in sensorSwi
+*
+******************************************************************************
+*/
+void streamSample(const SensorDevice* device, uint32_t timestamp);
+
+/**
+*****************************************************************************
+*
+*  @brief Selects the text, binary or streaming telemetry of UART0
+*
+*  @b example
+*  @code
+*      setTelemetryMode(telemetry_Mode_Stream);
+*  @endcode
+*
+*  @note
+*      Streaming changes the baud rate to UART_SPEED_STREAM and samples the sensors back to
+*      back, the other modes go back to UART_SPEED. Only from main or a task
+*
+******************************************************************************
+*/
+void setTelemetryMode(TelemetryMode mode);
+
+/**
+*****************************************************************************
+*
+*  @brief Interrupt routine for the SSI2 module used by the display
+*
+*  @b example
+*  @code
+*      N/A
+*  @endcode
+*
+*  @note
+*      N/A
+*
+******************************************************************************
+*/
+Void ssi2Hwi(UArg arg);
 
 /**
 *****************************************************************************
 *
-*  @brief Interrupt routine for the I2C2 module
+*  @brief Interrupt routine for the sequencer 1 of the ADC0
 *
 *  @b example
 *  @code
@@ -220,11 +350,28 @@ Void timer2AHwInt(UArg arg);
 *  @endcode
 *
 *  @note
+*      Only comes when the uDMA fills a buffer of the internal temperature
+*
+******************************************************************************
+*/
+Void adc0Hwi(UArg arg);
+
+/**
+*****************************************************************************
+*
+*  @brief Interrupt routine for the comparators of the ADC0
+*
+*  @b example
+*  @code
 *      N/A
+*  @endcode
+*
+*  @note
+*      Only comes in alarm mode when the internal temperature crosses a threshold
 *
 ******************************************************************************
 */
-Void i2c2Hwi(UArg arg);
+Void adc0AlarmHwi(UArg arg);
 
 /*
  * Global variables
@@ -235,34 +382,85 @@ uint8_t  ui8Minutes = 59; /* Minutes, range 0 to 59 */
 uint8_t  ui8Seconds = 59; /* Seconds, range 0 to 59 */
 uint16_t u16MillisecondsCount = 0;
 
-bool     sensor_First_Read_Flag              = true;
 uint8_t  sensor_Temperature_Units            = ZERO;
 uint8_t  sensor_Temperature_Tens             = ZERO;
 uint8_t  sensor_Temperature_Decimals         = ZERO;
-uint8_t  sensor_Ctrl_Meas                    = MODE_FORCED | T_OS_1;
-uint8_t  sensor_Parameter_Address            = PARAM_DIG_T1_LSB;
-uint8_t  sensor_Parameter_Count              = ZERO;
-uint8_t  sensor_Data_Counter                 = ZERO;
+uint8_t  sensor_Ctrl_Meas                    = MODE_NORMAL | T_OS_1 | P_OS_1;
+uint8_t  sensor_Config                       = T_SB_62_5MS | IIR_OFF;
+uint8_t  sensor_Ctrl_Hum                     = H_OS_1;
 uint32_t sensor_ADC_Temperature              = ZERO;
-uint16_t sensor_Digit_T1                     = ZERO;
-int16_t  sensor_Digit_T2                     = ZERO;
-int16_t  sensor_Digit_T3                     = ZERO;
-uint16_t sensor_Unused_Param                 = ZERO;
-double   sensor_Temperature                  = ZERO_FLOAT;
-double   sensor_Temperature_Average          = ZERO_FLOAT;
+int32_t  sensor_Temperature                  = ZERO;
+uint32_t sensor_Pressure                     = ZERO;
+uint32_t sensor_Humidity                     = ZERO;
+int32_t  sensor_T_Fine                       = ZERO;
+uint32_t sensor_Measure_Time                 = ZERO;
+uint32_t sensor_Interrupt_Count              = ZERO;
+uint32_t sensor_Interrupts_Per_Sample        = ZERO;
+uint32_t sensor_Samples_Total                = ZERO;
+uint32_t sensor_Samples_Per_Second           = ZERO;
+volatile uint8_t sensor_Device_Count         = ZERO;
+uint32_t sensor_Tick_Count                   = ZERO;
+uint32_t sensor_Recovery_Ms_Max              = ZERO;
+uint32_t sensor_Recovery_Over_Bound          = ZERO;
+volatile uint8_t sensor_Injected_Faults      = ZERO;
+volatile bool    sensor_Streaming            = false;
+int32_t  sensor_Temperature_Average          = ZERO;
 int8_t   sensor_Avg_Temperature_Integer      = ZERO;
 int8_t   sensor_Avg_Temperature_Fraction     = ZERO;
 int8_t   sensor_Current_Temperature_Integer  = ZERO;
 int8_t   sensor_Current_Temperature_Fraction = ZERO;
 uint8_t  sensor_Current_Sample               = ZERO;
+uint8_t  sensor_Window_Length                = TEMPERATURE_SAMPLES;
+volatile uint8_t sensor_Window_Request       = TEMPERATURE_SAMPLES;
+uint8_t  sensor_Window_Count                 = ZERO;
+int32_t  sensor_Temperature_Sum              = ZERO;
 
 float                   sensor_Temperature_Array_ADC[TEMPERATURE_SAMPLES]  = { ZERO_FLOAT };
-double                  sensor_Temperature_Array[TEMPERATURE_SAMPLES]      = { ZERO_FLOAT };
-double                  sensor_Temperature_Compensation                    = 3;
-volatile uint16_t       sensor_ADC_Data_Temperature[2]                     = { ZERO };
-uint8_t                 sensor_Dig_Temperature [6]                         = { ZERO };
-BM280State              sensor_State                                       = state_Read_Calibration;
-DetaTemperatureStatus   sensor_Delta_Temperature                           = data_Temp_Normal;
+int32_t                 sensor_Temperature_Array[TEMPERATURE_SAMPLES_MAX]  = { ZERO };
+int32_t                 sensor_Temperature_Compensation                    = 3 * CENTIDEGREES_PER_DEGREE;
+ProfilingCounter        sensor_Compensation_Cycles                         = { ZERO };
+ProfilingCounter        sensor_Startup_Cycles                              = { ZERO };
+ProfilingCounter        sensor_Bus_Cycles                                  = { ZERO };
+ProfilingCounter        sensor_Sample_Cycles                               = { ZERO };
+ProfilingCounter        sensor_Isr_Cycles                                  = { ZERO };
+ProfilingCounter        sensor_Classifier_Cycles                           = { ZERO };
+
+UartTxRing              uart_Tx_Ring                                       = { ZERO };
+ProfilingCounter        uart_Format_Cycles                                 = { ZERO };
+TelemetryMode           uart_Telemetry_Mode                                = telemetry_Mode_Text;
+uint32_t                uart_Baud                                          = UART_SPEED;
+volatile uint32_t       uart_Stream_Dropped                                = ZERO;
+uint8_t                 uart_Stream_Batch                                  = TELEMETRY_STREAM_SAMPLES_MAX;
+TelemetryStream         uart_Stream_Batches[SENSOR_MAX_DEVICES]            = { ZERO };
+uint16_t                adc_Ping_Buffer[ADC_BLOCK_LENGTH]                  = { ZERO };
+uint16_t                adc_Pong_Buffer[ADC_BLOCK_LENGTH]                  = { ZERO };
+volatile int32_t        adc_Die_Temperature                                = ZERO;
+volatile uint32_t       adc_Die_Variance                                   = ZERO;
+uint32_t                adc_Sample_Rate                                    = ADC_SAMPLE_RATE_HZ;
+uint32_t                adc_Blocks                                         = ZERO;
+uint32_t                adc_Overruns                                       = ZERO;
+ProfilingCounter        adc_Block_Cycles                                   = { ZERO };
+volatile AdcAlarm       adc_Alarm                                          = adc_Alarm_None;
+bool                    adc_Alarm_Mode                                     = false;
+int32_t                 adc_Alarm_Over_Centi                               = ADC_ALARM_OVER_CENTI;
+int32_t                 adc_Alarm_Under_Centi                              = ADC_ALARM_UNDER_CENTI;
+uint32_t                adc_Alarm_Count                                    = ZERO;
+uint32_t                adc_Alarm_Latency                                  = ZERO;
+uint32_t                adc_Alarm_Latency_Max                              = ZERO;
+SensorStatistics        sensor_Statistics                                  = { ZERO };
+SensorSampleCallback    sensor_Sample_Callback                             = NULL;
+SensorSampleRing        sensor_Sample_Ring                                 = { { { { ZERO } } } };
+SensorDevice            sensor_Devices[SENSOR_MAX_DEVICES]                 = { { ZERO } };
+SensorBus               sensor_Buses[SENSOR_BUS_COUNT]                     = { { { ZERO } } };
+FilterStage             sensor_Filters[FILTER_MAX_STAGES]                  = { filter_None };
+volatile uint8_t        sensor_Filter_Count                                = ZERO;
+volatile DetaTemperatureStatus sensor_Delta_Temperature                    = data_Temp_Stabilizing;
+
+// Status of the sensor on the display and the UART, in the order of DetaTemperatureStatus
+static const uint8_t sensorStatusSegments[] = { SEVEN_DIGIT_DISPLAY_BLANK, SEVEN_DIGIT_DISPLAY_S_LETTER_CL,
+                                                SEVEN_DIGIT_DISPLAY_A_LETTER_CL, SEVEN_DIGIT_DISPLAY_L_LETTER_CL };
+static const char* const sensorStatusLabels[] = { STATUS_NORMAL_LABEL, STATUS_STABILIZING_LABEL,
+                                                  STATUS_ABNORMAL_LABEL, STATUS_LOST_CONNECTION_LABEL };
 
 /*
  *  ======== stateMachine ========
@@ -274,16 +472,16 @@ Void stateMachine(UArg arg0, UArg arg1)
 {
     int microState = 0;
     int timeCount = 0;
-    float temperature = 0.0;
+    int32_t temperature = 0;
     while (1)
     {
         Task_sleep((unsigned int)arg0);
-        temperature = (float)sensor_Temperature_Average;
+        temperature = CENTIDEGREES_TO_TENTHS(sensor_Temperature_Average);
         microState = stateMachineDecodeFxn();
         switch(microState)
         {
         case STATE_TEMPERATURE_SENSOR:
-            displayTempValue(temperature);
+            displayTempValueStatus(temperature, sensorStatusSegments[sensor_Delta_Temperature]);
             break;
         case STATE_DISPLAY_CLOCK:
             displayTime(ui8Hour, ui8Minutes);
@@ -334,48 +532,18 @@ Void stateMachine(UArg arg0, UArg arg1)
             }
             break;
         default:
-            displayTempValue(temperature);
+            displayTempValueStatus(temperature, sensorStatusSegments[sensor_Delta_Temperature]);
             break;
         }
     }
 }
 
-Void ADC0Fxn(UArg arg0, UArg arg1)
-{
-    /* Main temperature */
-    float ADCTemperatureValue = 0.0;
-    /* Array to store ADC values sampled */
-    uint32_t ui32ADC0Value[4];
-    /* Array to store ADC values sampled */
-
-    while (1)
-    {
-        Task_sleep((unsigned int)arg0);
-        /* Cleans int for ADC0 */
-        ADCIntClear(ADC0_BASE, 1);
-
-        /* Triggers conversion*/
-        ADCProcessorTrigger(ADC0_BASE, 1);
-
-        /* Waits for the conversion to end */
-        while(!ADCIntStatus(ADC0_BASE, 1, false));
-
-        /* Saves the value of the conversion */
-        ADCSequenceDataGet(ADC0_BASE, 1, ui32ADC0Value);
-
-        /* Average value from sequencers */
-        ADCTemperatureValue = (float)(ui32ADC0Value[0] + ui32ADC0Value[1] + ui32ADC0Value[2] + ui32ADC0Value[3] + 2)/4;
-        /* Converts the value from digital to analog */
-        ADCTemperatureValue = (1475 - ((2475 * ADCTemperatureValue)) / 4096)/10;
-
-    }
-}
-
 Void timer1AHwInt(UArg arg)
 {
     // Interruption generated every 1 second
     TimerIntClear(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
-    sendTemperatureValueUart((float)sensor_Temperature_Average);
+    Swi_post(telemetrySwi);
+    updateSensorRate();
     // 60 Seconds have passed
     ui8Seconds++;
     if(ui8Seconds >= SECONDS_MAX_VALUE)
@@ -397,48 +565,234 @@ Void timer1AHwInt(UArg arg)
 
 Void timer2AHwInt(UArg arg)
 {
-    // Interruption generated every 100 milliseconds
+    // Interruption generated every SENSOR_TICK_MS
     TimerIntClear(TIMER2_BASE, TIMER_TIMA_TIMEOUT);
-    // Here goes the temperature value
-    if(!sensor_First_Read_Flag)
+    // Here goes the temperature value, sensors still busy are skipped
+    if(startTemperatureSample())
     {
-        sensor_State = state_Sensor_Configuration_Finished;
+        // The bus clear of a failed sensor busy-waits, it runs in the Swi
+        Swi_post(sensorSwi);
+    }
+}
 
-        I2CMasterSlaveAddrSet(I2C2_BASE, SLAVE_ADDRESS_EXT, false);
-        I2CMasterDataPut(I2C2_BASE, REGISTER_MEASCTRL);
-        I2CMasterControl(I2C2_BASE, I2C_MASTER_CMD_BURST_SEND_START);
-        sensor_First_Read_Flag = true;
+Void timer3AHwInt(UArg arg)
+{
+    sensorMeasureTimeout();
+}
+
+Void i2cSensorHwi(UArg arg)
+{
+    if(temperatureSensor((uint8_t)arg))
+    {
+        Swi_post(sensorSwi);
     }
+}
 
+Void sensorSwiFxn(UArg arg0, UArg arg1)
+{
+    recoverSensorBuses();
+    processTemperatureSamples();
+}
+
+Void telemetrySwiFxn(UArg arg0, UArg arg1)
+{
+    static TelemetryRecord records[telemetry_Channel_Count];
+    uint32_t               timestamp = sensor_Tick_Count * SENSOR_TICK_MS;
+    uint8_t                index;
+
+    // The stream sends its own frames, as soon as every batch is full
+    if(uart_Telemetry_Mode == telemetry_Mode_Stream) { return; }
+
+    if(uart_Telemetry_Mode == telemetry_Mode_Text)
+    {
+        sendTemperatureValueUart((float)sensor_Temperature_Average / CENTIDEGREES_PER_DEGREE, sensorStatusLabels[sensor_Delta_Temperature]);
+        return;
+    }
+
+    // One record per channel, the same timestamp for all of them
+    records[telemetry_Channel_Temperature].value     = sensor_Temperature_Average;
+    records[telemetry_Channel_Pressure].value        = (int32_t)sensor_Pressure;
+    records[telemetry_Channel_Humidity].value        = (int32_t)sensor_Humidity;
+    records[telemetry_Channel_Die_Temperature].value = adc_Die_Temperature;
+    for(index = 0; index < telemetry_Channel_Count; index++)
+    {
+        records[index].timestamp = timestamp;
+        records[index].channel   = index;
+    }
+    sendTelemetryRecords(records, telemetry_Channel_Count);
+}
+
+Void uart0Hwi(UArg arg)
+{
+    uartTxInterrupt();
 }
 
-Void i2c2Hwi(UArg arg)
+void streamSample(const SensorDevice* device, uint32_t timestamp)
 {
-    temperatureSensor();
+    TelemetryStream* batch = &uart_Stream_Batches[device->index];
+    TelemetrySample* sample;
+    uint32_t         offset;
+
+    if(batch->count == ZERO)
+    {
+        batch->timestamp = timestamp;
+        batch->sensor    = device->index;
+    }
+    // Cycles to TELEMETRY_STREAM_OFFSET_US units, the batch is shorter than the 16 bits
+    offset = (timestamp - batch->timestamp) / ((SYSCLOCK_SPEED / MICROSECONDS_PER_SECOND) * TELEMETRY_STREAM_OFFSET_US);
+    sample = &batch->samples[batch->count];
+    sample->offset      = (offset > UINT16_MAX) ? UINT16_MAX : (uint16_t)offset;
+    sample->temperature = (int16_t)device->temperature;
+    sample->humidity    = (uint16_t)((device->humidity * 100) >> HUMIDITY_FRACTION_BITS);
+    sample->pressure    = device->pressure;
+    batch->count++;
+
+    if(batch->count >= uart_Stream_Batch)
+    {
+        // A full ring drops the batch, the next frame reports it
+        sendTelemetryStream(batch);
+        batch->count = ZERO;
+    }
 }
 
-inline void hwiCreation(void)
+void setTelemetryMode(TelemetryMode mode)
 {
-    Hwi_Params hwiParamsTimer1A, hwiParamsTimer2A, hwiParamsI2C2;
-    Error_Block ebTimer1A, ebTimer2A, ebI2C2;
+    uint8_t device_Index;
+
+    if(mode == telemetry_Mode_Stream)
+    {
+        for(device_Index = ZERO; device_Index < SENSOR_MAX_DEVICES; device_Index++) { uart_Stream_Batches[device_Index].count = ZERO; }
+        if(uart_Stream_Batch == ZERO || uart_Stream_Batch > TELEMETRY_STREAM_SAMPLES_MAX) { uart_Stream_Batch = TELEMETRY_STREAM_SAMPLES_MAX; }
+        uartSetBaud(UART_SPEED_STREAM);
+        sensor_Sample_Callback = streamSample;
+        sensorSetStreaming(true);
+    }
+    else
+    {
+        sensorSetStreaming(false);
+        sensor_Sample_Callback = NULL;
+        uartSetBaud(UART_SPEED);
+    }
+    uart_Telemetry_Mode = mode;
+}
+
+Void ssi2Hwi(UArg arg)
+{
+    displaySsiInterrupt();
+}
+
+Void adc0Hwi(UArg arg)
+{
+    adcInterrupt();
+}
+
+Void adc0AlarmHwi(UArg arg)
+{
+    adcAlarmInterrupt();
+}
+
+static inline void hwiCreation(void)
+{
+    Hwi_Params hwiParamsTimer1A, hwiParamsTimer2A, hwiParamsTimer3A, hwiParamsI2C2, hwiParamsI2C8, hwiParamsSSI2, hwiParamsADC0, hwiParamsADC0Alarm, hwiParamsUART0;
+    Error_Block ebTimer1A, ebTimer2A, ebTimer3A, ebI2C2, ebI2C8, ebSSI2, ebADC0, ebADC0Alarm, ebUART0;
+#if SENSOR_USE_I2C7
+    Hwi_Params hwiParamsI2C7;
+    Error_Block ebI2C7;
+#endif
 
     /* Hardware interrupt for TIMER1A */
     Hwi_Params_init(&hwiParamsTimer1A);
     Error_init(&ebTimer1A);
     hwiParamsTimer1A.maskSetting = Hwi_MaskingOption_SELF;
     timer1AHwi = Hwi_create(INT_TIMER1A, timer1AHwInt, &hwiParamsTimer1A, &ebTimer1A);
+    if(Error_check(&ebTimer1A)) { System_abort("Couldn't create the TIMER1A hwi"); }
 
     /* Hardware interrupt for TIMER2A */
     Hwi_Params_init(&hwiParamsTimer2A);
     Error_init(&ebTimer2A);
     hwiParamsTimer2A.maskSetting = Hwi_MaskingOption_SELF;
     timer2AHwi = Hwi_create(INT_TIMER2A, timer2AHwInt, &hwiParamsTimer2A, &ebTimer2A);
+    if(Error_check(&ebTimer2A)) { System_abort("Couldn't create the TIMER2A hwi"); }
 
-    /* Hardware interrupt for TIMER1A */
+    /* Hardware interrupt for TIMER3A */
+    Hwi_Params_init(&hwiParamsTimer3A);
+    Error_init(&ebTimer3A);
+    hwiParamsTimer3A.maskSetting = Hwi_MaskingOption_SELF;
+    timer3AHwi = Hwi_create(INT_TIMER3A, timer3AHwInt, &hwiParamsTimer3A, &ebTimer3A);
+    if(Error_check(&ebTimer3A)) { System_abort("Couldn't create the TIMER3A hwi"); }
+
+    /* Hardware interrupt for I2C2, the argument is the bus of the sensors */
     Hwi_Params_init(&hwiParamsI2C2);
     Error_init(&ebI2C2);
     hwiParamsI2C2.maskSetting = Hwi_MaskingOption_SELF;
-    I2C2Hwi = Hwi_create(INT_I2C2, i2c2Hwi, &hwiParamsI2C2, &ebI2C2);
+    hwiParamsI2C2.arg = SENSOR_BUS_I2C2;
+    I2C2Hwi = Hwi_create(INT_I2C2, i2cSensorHwi, &hwiParamsI2C2, &ebI2C2);
+    if(Error_check(&ebI2C2)) { System_abort("Couldn't create the I2C2 hwi"); }
+
+    /* Hardware interrupt for I2C8, same priority as I2C2 */
+    Hwi_Params_init(&hwiParamsI2C8);
+    Error_init(&ebI2C8);
+    hwiParamsI2C8.maskSetting = Hwi_MaskingOption_SELF;
+    hwiParamsI2C8.arg = SENSOR_BUS_I2C8;
+    I2C8Hwi = Hwi_create(INT_I2C8, i2cSensorHwi, &hwiParamsI2C8, &ebI2C8);
+    if(Error_check(&ebI2C8)) { System_abort("Couldn't create the I2C8 hwi"); }
+
+#if SENSOR_USE_I2C7
+    /* Hardware interrupt for I2C7, same priority as I2C2 */
+    Hwi_Params_init(&hwiParamsI2C7);
+    Error_init(&ebI2C7);
+    hwiParamsI2C7.maskSetting = Hwi_MaskingOption_SELF;
+    hwiParamsI2C7.arg = SENSOR_BUS_I2C7;
+    I2C7Hwi = Hwi_create(INT_I2C7, i2cSensorHwi, &hwiParamsI2C7, &ebI2C7);
+    if(Error_check(&ebI2C7)) { System_abort("Couldn't create the I2C7 hwi"); }
+#endif
+
+    /* Hardware interrupt for SSI2 */
+    Hwi_Params_init(&hwiParamsSSI2);
+    Error_init(&ebSSI2);
+    hwiParamsSSI2.maskSetting = Hwi_MaskingOption_SELF;
+    SSI2Hwi = Hwi_create(INT_SSI2, ssi2Hwi, &hwiParamsSSI2, &ebSSI2);
+    if(Error_check(&ebSSI2)) { System_abort("Couldn't create the SSI2 hwi"); }
+
+    /* Hardware interrupt for the sequencer 1 of ADC0 */
+    Hwi_Params_init(&hwiParamsADC0);
+    Error_init(&ebADC0);
+    hwiParamsADC0.maskSetting = Hwi_MaskingOption_SELF;
+    ADC0Hwi = Hwi_create(INT_ADC0SS1, adc0Hwi, &hwiParamsADC0, &ebADC0);
+    if(Error_check(&ebADC0)) { System_abort("Couldn't create the ADC0 hwi"); }
+
+    /* Hardware interrupt for the comparators, they use the line of sequencer 2 */
+    Hwi_Params_init(&hwiParamsADC0Alarm);
+    Error_init(&ebADC0Alarm);
+    hwiParamsADC0Alarm.maskSetting = Hwi_MaskingOption_SELF;
+    ADC0AlarmHwi = Hwi_create(INT_ADC0SS2, adc0AlarmHwi, &hwiParamsADC0Alarm, &ebADC0Alarm);
+    if(Error_check(&ebADC0Alarm)) { System_abort("Couldn't create the ADC0 alarm hwi"); }
+
+    /* Hardware interrupt for UART0, also pended by every new telemetry line */
+    Hwi_Params_init(&hwiParamsUART0);
+    Error_init(&ebUART0);
+    hwiParamsUART0.maskSetting = Hwi_MaskingOption_SELF;
+    UART0Hwi = Hwi_create(INT_UART0, uart0Hwi, &hwiParamsUART0, &ebUART0);
+    if(Error_check(&ebUART0)) { System_abort("Couldn't create the UART0 hwi"); }
+}
+
+static inline void swiCreation(void)
+{
+    Swi_Params swiParamsSensor, swiParamsTelemetry;
+    Error_Block ebSensor, ebTelemetry;
+
+    /* Software interrupt for the sensor samples. Both Swis keep the default priority,
+     * neither preempts the other and the static frame buffers of the telemetry rely on it */
+    Swi_Params_init(&swiParamsSensor);
+    Error_init(&ebSensor);
+    sensorSwi = Swi_create(sensorSwiFxn, &swiParamsSensor, &ebSensor);
+    if(Error_check(&ebSensor)) { System_abort("Couldn't create the sensor swi"); }
+
+    /* Software interrupt for the telemetry, the timer only posts it */
+    Swi_Params_init(&swiParamsTelemetry);
+    Error_init(&ebTelemetry);
+    telemetrySwi = Swi_create(telemetrySwiFxn, &swiParamsTelemetry, &ebTelemetry);
+    if(Error_check(&ebTelemetry)) { System_abort("Couldn't create the telemetry swi"); }
 }
 
 /*
@@ -451,9 +805,16 @@ int main(void)
     /* Hardware interrupt creation */
     hwiCreation();
 
+    /* Software interrupt creation */
+    swiCreation();
+
     /* Call board init functions */
     Board_initGeneral();
     Board_initGPIO();
+    EK_TM4C129EXL_initDMA();
+
+    /* Cycle counter used to measure the drivers */
+    initProfiling();
 
     /* Peripherals intialization */
     initDisplay();
@@ -461,7 +822,18 @@ int main(void)
     initTimers();
     initRs232();
     initSensor();
+    /* More sensors sample in parallel with the first one */
+    //addSensor(SENSOR_BUS_I2C2, SLAVE_ADDRESS_ALT);
+    //addSensor(SENSOR_BUS_I2C8, SLAVE_ADDRESS_EXT);
+    /* Internal temperature sampled by TIMER4 and the uDMA */
     initADC0();
+    /* Only the comparators watch the internal temperature */
+    //adcSetAlarmMode(true);
+    /* Telemetry mode of the build, the text one is already running */
+    if(TELEMETRY_BOOT_MODE != telemetry_Mode_Text)
+    {
+        setTelemetryMode(TELEMETRY_BOOT_MODE);
+    }
 
     /* Display Test before showing temperature */
     //displayTest();
@@ -473,11 +845,6 @@ int main(void)
     taskParams.stack = &taskSMStack;
     Task_construct(&taskSMStruct, (Task_FuncPtr)stateMachine, &taskParams, NULL);
 
-    /* Construct stateMachine Task  thread */
-    taskParams.arg0 = 1000;
-    taskParams.stack = &taskADCStack;
-    Task_construct(&taskADCStruct, (Task_FuncPtr)ADC0Fxn, &taskParams, NULL);
-
 
      /* Turn on user LED to indicates operation*/
     GPIO_write(Board_LED0, Board_LED_ON);